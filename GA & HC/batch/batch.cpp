@@ -0,0 +1,399 @@
+#include "batch.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <condition_variable>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include "../genetic/genetic.h"
+#include "../hill_climbing/hill_climbing.h"
+#include "../image/image_loader.h"
+#include "../image/image_writer.h"
+#include "../utilities/fnv.h"
+#include "../utilities/random.h"
+#include "../utilities/thread_pool.h"
+
+const char* batch::algorithm_name(const algorithm value) {
+    return value == algorithm::genetic ? "ga" : "hc";
+}
+
+const char* batch::format_name(const encoding::format value) {
+    switch (value) {
+    case encoding::format::luma: return "gray";
+    case encoding::format::bits: return "binary";
+    default: return "color";
+    }
+}
+
+// Splits a manifest line on whitespace; double quotes group a token with spaces.
+static std::vector<std::string> tokenize(const std::string& line) {
+    std::vector<std::string> tokens;
+    for (size_t i = 0; i < line.size();) {
+        if (std::isspace(static_cast<unsigned char>(line[i]))) {
+            ++i;
+            continue;
+        }
+        if (line[i] == '#')
+            break;
+
+        std::string token;
+        bool quoted = false;
+        for (; i < line.size() && (quoted || !std::isspace(static_cast<unsigned char>(line[i]))); ++i) {
+            if (line[i] == '"')
+                quoted = !quoted;
+            else
+                token += line[i];
+        }
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+static bool parse_number(const std::string& text, double& value) {
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && value >= 0.0;
+}
+
+static bool parse_integer(const std::string& text, uint64_t& value) {
+    if (text.empty() || !std::all_of(text.begin(), text.end(), [](const char c) { return c >= '0' && c <= '9'; }))
+        return false;
+    value = std::strtoull(text.c_str(), nullptr, 10);
+    return true;
+}
+
+bool batch::parse_manifest(const char* path, const job& defaults, std::vector<job>& jobs, std::string& error) {
+    std::ifstream file(path);
+    if (!file) {
+        error = std::string("cannot open manifest '") + path + "'";
+        return false;
+    }
+
+    const std::filesystem::path base = std::filesystem::path(path).parent_path();
+    std::string line;
+    for (size_t line_number = 1; std::getline(file, line); ++line_number) {
+        const std::vector<std::string> tokens = tokenize(line);
+        if (tokens.empty())
+            continue;
+
+        const std::string where = std::string(path) + ":" + std::to_string(line_number) + ": ";
+        if (tokens.size() < 3) {
+            error = where + "expected <target> <ga|hc> <color|gray|binary> [key=value ...]";
+            return false;
+        }
+
+        job work = defaults;
+        work.name.clear();
+        work.target_path = (base / tokens[0]).string();
+
+        if (tokens[1] == "ga")
+            work.kind = algorithm::genetic;
+        else if (tokens[1] == "hc")
+            work.kind = algorithm::hill_climbing;
+        else {
+            error = where + "unknown algorithm '" + tokens[1] + "'";
+            return false;
+        }
+
+        if (tokens[2] == "color")
+            work.format = encoding::format::bgra;
+        else if (tokens[2] == "gray")
+            work.format = encoding::format::luma;
+        else if (tokens[2] == "binary")
+            work.format = encoding::format::bits;
+        else {
+            error = where + "unknown mode '" + tokens[2] + "'";
+            return false;
+        }
+
+        bool has_seed = false;
+        for (size_t i = 3; i < tokens.size(); ++i) {
+            const size_t separator = tokens[i].find('=');
+            const std::string key = tokens[i].substr(0, separator);
+            const std::string value = separator == std::string::npos ? std::string() : tokens[i].substr(separator + 1);
+            double number = 0.0;
+            uint64_t integer = 0;
+
+            bool valid = false;
+            if (key == "name") {
+                work.name = value;
+                valid = !value.empty();
+            }
+            else if (key == "seed") {
+                valid = has_seed = parse_integer(value, integer);
+                work.seed = integer;
+            }
+            else if (key == "target-fitness") {
+                valid = parse_number(value, number);
+                work.target_fitness = static_cast<float>(number);
+            }
+            else if (key == "max-generations") {
+                valid = parse_integer(value, integer) && integer <= UINT32_MAX;
+                work.max_generations = static_cast<unsigned int>(integer);
+            }
+            else if (key == "max-iterations") {
+                valid = parse_integer(value, integer) && integer <= UINT32_MAX;
+                work.max_iterations = static_cast<unsigned int>(integer);
+            }
+            else if (key == "max-seconds") {
+                valid = parse_number(value, number);
+                work.max_seconds = number;
+            }
+            else if (key == "selection")
+                valid = selection::parse_method(value.c_str(), work.selection);
+            else if (key == "crossover")
+                valid = work.override_crossover = crossover::parse_method(value.c_str(), work.crossover);
+
+            if (!valid) {
+                error = where + "invalid option '" + tokens[i] + "'";
+                return false;
+            }
+        }
+
+        if (!has_seed)
+            work.seed = rng::derive_seed(defaults.seed, jobs.size());
+        if (work.name.empty()) {
+            char prefix[16];
+            std::snprintf(prefix, sizeof(prefix), "%04zu-", jobs.size());
+            work.name = prefix + std::filesystem::path(tokens[0]).stem().string() + "-" + algorithm_name(work.kind) + "-" + format_name(work.format);
+        }
+        jobs.push_back(std::move(work));
+    }
+    return true;
+}
+
+// Rough cost in GA generations, used only to start long jobs first. A hill
+// climbing step measures at about a hundredth of a generation, and a small
+// target runs some 20k generations per second.
+static double estimated_cost(const batch::job& work) {
+    const unsigned int budget = work.kind == batch::algorithm::genetic ? work.max_generations : work.max_iterations;
+    const double per_step = work.kind == batch::algorithm::genetic ? 1.0 : 0.01;
+    double cost = budget ? budget * per_step : HUGE_VAL;
+    if (work.max_seconds > 0.0)
+        cost = std::min(cost, work.max_seconds * 20'000.0);
+    return cost;
+}
+
+namespace {
+    // Requests a job's stop once its wall clock budget is spent. Sleeps until
+    // the earliest deadline rather than polling.
+    struct deadline_watch {
+        struct entry {
+            std::stop_source* source;
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        std::mutex mtx;
+        std::condition_variable_any cv;
+        std::vector<entry> entries;
+        bool added = false;
+
+        void add(std::stop_source* source, const double seconds) {
+            if (seconds <= 0.0)
+                return;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                entries.push_back({ source, std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds)) });
+                added = true;
+            }
+            cv.notify_one();
+        }
+
+        void remove(std::stop_source* source) {
+            std::lock_guard<std::mutex> lock(mtx);
+            std::erase_if(entries, [source](const entry& e) { return e.source == source; });
+        }
+
+        void watch(const std::stop_token& stop) {
+            std::unique_lock<std::mutex> lock(mtx);
+            while (!stop.stop_requested()) {
+                const auto now = std::chrono::steady_clock::now();
+                std::erase_if(entries, [now](const entry& e) {
+                    if (now < e.deadline)
+                        return false;
+                    e.source->request_stop();
+                    return true;
+                });
+
+                // add() may bring an earlier deadline, so it wakes the wait too.
+                added = false;
+                if (entries.empty()) {
+                    cv.wait(lock, stop, [this] { return added; });
+                }
+                else {
+                    const auto earliest = std::min_element(entries.begin(), entries.end(), [](const entry& a, const entry& b) { return a.deadline < b.deadline; });
+                    cv.wait_until(lock, stop, earliest->deadline, [this] { return added; });
+                }
+            }
+        }
+    };
+}
+
+static float default_target_fitness(const batch::job& work) {
+    if (work.kind == batch::algorithm::genetic) {
+        switch (work.format) {
+        case encoding::format::luma: return genetic_algorithm::gray_scale_target_fitness;
+        case encoding::format::bits: return genetic_algorithm::binary_target_fitness;
+        default: return genetic_algorithm::color_target_fitness;
+        }
+    }
+    switch (work.format) {
+    case encoding::format::luma: return hill_climbing::gray_scale_target_fitness;
+    case encoding::format::bits: return hill_climbing::binary_target_fitness;
+    default: return hill_climbing::color_target_fitness;
+    }
+}
+
+static void run_job(const batch::job& work, const std::filesystem::path& output_directory, deadline_watch& watch, const std::stop_token& stop, batch::job_result& result) {
+    if (stop.stop_requested()) {
+        result.stopped = true;
+        result.error = "batch stopped before the job started";
+        return;
+    }
+
+    image::bitmap loaded;
+    if (!image::load(work.target_path.c_str(), loaded, result.error))
+        return;
+    const globals::target_image target = globals::make_target(loaded.width, loaded.height, loaded.bgra.data());
+
+    result.width = target.width;
+    result.height = target.height;
+    result.target_fitness = work.target_fitness >= 0.f ? work.target_fitness : default_target_fitness(work);
+
+    // Stopped by the job's deadline or by stopping the whole batch.
+    std::stop_source job_stop;
+    const std::stop_callback forward_stop(stop, [&job_stop] { job_stop.request_stop(); });
+
+    individual best;
+    const auto start = std::chrono::steady_clock::now();
+    if (work.kind == batch::algorithm::genetic) {
+        genetic_algorithm::run_config config;
+        config.format = work.format;
+        config.selection.kind = work.selection;
+        config.crossover.kind = work.override_crossover ? work.crossover : work.format == encoding::format::bgra ? crossover::method::single_point : crossover::method::pixel;
+        config.target_fitness = result.target_fitness;
+        config.max_generations = work.max_generations;
+        config.seed = work.seed;
+
+        genetic_algorithm::run_state state;
+        watch.add(&job_stop, work.max_seconds);
+        genetic_algorithm::run(target, config, state, job_stop.get_token());
+        watch.remove(&job_stop);
+
+        best = std::move(state.best);
+        result.generations = state.generation.load();
+    }
+    else {
+        hill_climbing::run_config config;
+        config.format = work.format;
+        config.target_fitness = result.target_fitness;
+        config.max_iterations = work.max_iterations;
+        config.seed = work.seed;
+
+        hill_climbing::run_state state;
+        watch.add(&job_stop, work.max_seconds);
+        hill_climbing::run(target, config, state, job_stop.get_token());
+        watch.remove(&job_stop);
+
+        best = std::move(state.best);
+        result.generations = state.generation.load();
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.stopped = stop.stop_requested();
+    result.fitness = best.fitness;
+    result.reached_target = best.fitness >= result.target_fitness;
+
+    result.digest = hash::fnv1a64(best.genome.data(), best.genome.size(), 0xCBF29CE484222325ULL);
+    result.digest = hash::fnv1a64(&best.fitness, sizeof(best.fitness), result.digest);
+    result.digest = hash::fnv1a64(&result.generations, sizeof(result.generations), result.digest);
+
+    image::bitmap output{ target.width, target.height, std::vector<uint8_t>(target.bgra.size()) };
+    encoding::to_bgra(work.format, best.genome.data(), output.bgra.data(), target.pixel_count());
+    const std::string output_path = (output_directory / (work.name + ".png")).string();
+    result.ok = image::save_png(output_path.c_str(), output, result.error);
+}
+
+static void write_csv_field(std::FILE* file, const std::string& text) {
+    std::fputc('"', file);
+    for (const char c : text) {
+        if (c == '"')
+            std::fputc('"', file);
+        std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+const char* batch::status_name(const job_result& result) {
+    if (result.stopped)
+        return result.ok ? "stopped" : "cancelled";
+    return result.ok ? "ok" : "error";
+}
+
+static void write_result_row(std::FILE* file, const size_t index, const batch::job& work, const batch::job_result& result) {
+    std::fprintf(file, "%zu,", index);
+    write_csv_field(file, work.name);
+    std::fputc(',', file);
+    write_csv_field(file, work.target_path);
+    std::fprintf(file, ",%s,%s,%" PRIu64 ",%s,%u,%u,%.6f,%.6f,%d,%u,%.3f,%016" PRIx64 ",",
+        batch::algorithm_name(work.kind), batch::format_name(work.format), work.seed, batch::status_name(result),
+        result.width, result.height, result.fitness, result.target_fitness, result.reached_target ? 1 : 0,
+        result.generations, result.seconds, result.digest);
+    write_csv_field(file, result.error);
+    std::fputc('\n', file);
+    std::fflush(file);
+}
+
+bool batch::run(const std::vector<job>& jobs, const unsigned int threads, const std::string& output_directory, std::vector<job_result>& results, const finished_callback on_finished, const std::stop_token stop, std::string& error) {
+    std::error_code filesystem_error;
+    std::filesystem::create_directories(output_directory, filesystem_error);
+    if (filesystem_error) {
+        error = "cannot create '" + output_directory + "': " + filesystem_error.message();
+        return false;
+    }
+
+    const std::string csv_path = (std::filesystem::path(output_directory) / "results.csv").string();
+    std::FILE* csv = std::fopen(csv_path.c_str(), "w");
+    if (!csv) {
+        error = "cannot create '" + csv_path + "'";
+        return false;
+    }
+    std::fprintf(csv, "index,name,target,algorithm,mode,seed,status,width,height,fitness,target_fitness,reached_target,generations,seconds,digest,error\n");
+
+    // Longest first, so short jobs fill in behind them and no worker is left
+    // with one long job at the end while the others sit idle.
+    std::vector<size_t> order(jobs.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&jobs](const size_t a, const size_t b) {
+        return estimated_cost(jobs[a]) > estimated_cost(jobs[b]);
+    });
+
+    results.assign(jobs.size(), job_result{});
+    deadline_watch watch;
+    std::jthread watcher([&watch](const std::stop_token& watcher_stop) { watch.watch(watcher_stop); });
+    std::mutex finished_mtx;
+
+    const unsigned int workers = std::max(threads, 1U);
+    thread_pool pool(workers - 1U);
+    pool.parallel_for(order.size(), workers, [&](const size_t n) {
+        const size_t index = order[n];
+        run_job(jobs[index], output_directory, watch, stop, results[index]);
+
+        std::lock_guard<std::mutex> lock(finished_mtx);
+        write_result_row(csv, index, jobs[index], results[index]);
+        if (on_finished)
+            on_finished(jobs[index], results[index]);
+    });
+
+    watcher.request_stop();
+    watcher.join();
+    std::fclose(csv);
+    return true;
+}
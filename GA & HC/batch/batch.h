@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+#include <string>
+#include <vector>
+#include "../genetic/crossover.h"
+#include "../genetic/selection.h"
+#include "../utilities/encoding.h"
+
+namespace batch {
+    enum class algorithm { genetic, hill_climbing };
+
+    // One manifest line: a target image, the algorithm and mode to run on it
+    // and when to stop.
+    struct job {
+        std::string name;
+        std::string target_path;
+        algorithm kind = algorithm::genetic;
+        encoding::format format = encoding::format::bgra;
+        // Below 0 = the mode's default target fitness.
+        float target_fitness = -1.f;
+        // 0 = no limit; only the one matching kind applies.
+        unsigned int max_generations = 0U;
+        unsigned int max_iterations = 0U;
+        double max_seconds = 0.0;
+        uint64_t seed = 0;
+        selection::method selection = selection::method::tournament;
+        bool override_crossover = false;
+        crossover::method crossover = crossover::method::single_point;
+    };
+
+    struct job_result {
+        bool ok = false;
+        std::string error;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        float fitness = 0.f;
+        float target_fitness = 0.f;
+        bool reached_target = false;
+        unsigned int generations = 0U;
+        double seconds = 0.0;
+        uint64_t digest = 0;
+        // Cut short or never started because the batch was stopped; a
+        // stopped job that ran still has its best individual written.
+        bool stopped = false;
+    };
+
+    // Called from the worker that finished the job; calls are serialized.
+    using finished_callback = void (*)(const job& work, const job_result& result);
+
+    // Reads a manifest: one job per line as "<target> <ga|hc> <color|gray|binary>
+    // [key=value ...]", '#' starts a comment and targets are relative to the
+    // manifest. Keys: name, seed, target-fitness, max-generations,
+    // max-iterations, max-seconds, selection, crossover. Unset keys come from
+    // defaults; a job without a seed gets one derived from defaults.seed and
+    // its position in the manifest.
+    bool parse_manifest(const char* path, const job& defaults, std::vector<job>& jobs, std::string& error);
+
+    // Runs every job on `threads` threads, longest first, and fills results in
+    // job order. Each job's best individual is written to
+    // <output_directory>/<name>.png and its stats appended to results.csv there
+    // as soon as it finishes. Once stop is requested, running jobs end within
+    // a step and are written as usual; jobs not yet started are skipped.
+    bool run(const std::vector<job>& jobs, unsigned int threads, const std::string& output_directory, std::vector<job_result>& results, finished_callback on_finished, std::stop_token stop, std::string& error);
+
+    // ok, error, stopped (cut short, result written) or cancelled (never ran).
+    const char* status_name(const job_result& result);
+    const char* algorithm_name(algorithm value);
+    const char* format_name(encoding::format value);
+}
@@ -0,0 +1,191 @@
+#include "convergence.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include "../genetic/crossover.h"
+#include "../genetic/genetic.h"
+#include "../genetic/selection.h"
+#include "../utilities/random.h"
+
+uint64_t convergence::evaluations(const batch::job& work, const batch::job_result& result) {
+    if (work.kind == batch::algorithm::genetic)
+        return static_cast<uint64_t>(genetic_algorithm::population_size) * (result.generations + 1ULL);
+    return result.generations + 1ULL;
+}
+
+// Smallest value with at least share of values at or below it; values must be sorted.
+template <typename T>
+static T nearest_rank(const std::vector<T>& values, const double share) {
+    const size_t rank = static_cast<size_t>(std::ceil(share * values.size()));
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+
+static convergence::summary summarize(const batch::job& config, const std::vector<batch::job_result>& results, const size_t first, const unsigned int runs) {
+    convergence::summary result;
+    result.config = config;
+    result.runs = runs;
+
+    std::vector<double> seconds, evaluations;
+    std::vector<float> fitness;
+    for (size_t i = first; i < first + runs; ++i) {
+        const batch::job_result& run = results[i];
+        if (!run.ok || run.stopped) {
+            result.failed++;
+            continue;
+        }
+        result.target_fitness = run.target_fitness;
+        result.reached += run.reached_target;
+        seconds.push_back(run.reached_target ? run.seconds : HUGE_VAL);
+        evaluations.push_back(run.reached_target ? static_cast<double>(convergence::evaluations(config, run)) : HUGE_VAL);
+        fitness.push_back(run.fitness);
+    }
+    if (seconds.empty())
+        return result;
+
+    std::sort(seconds.begin(), seconds.end());
+    std::sort(evaluations.begin(), evaluations.end());
+    std::sort(fitness.begin(), fitness.end());
+    result.median_seconds = nearest_rank(seconds, 0.5);
+    result.p90_seconds = nearest_rank(seconds, 0.9);
+    result.median_evaluations = nearest_rank(evaluations, 0.5);
+    result.p90_evaluations = nearest_rank(evaluations, 0.9);
+    result.median_fitness = nearest_rank(fitness, 0.5);
+    result.worst_fitness = fitness.front();
+    result.best_fitness = fitness.back();
+    return result;
+}
+
+static const char* selection_name(const batch::job& config) {
+    return config.kind == batch::algorithm::genetic ? selection::method_name(config.selection) : "";
+}
+
+static const char* crossover_name(const batch::job& config) {
+    if (config.kind != batch::algorithm::genetic)
+        return "";
+    if (config.override_crossover)
+        return crossover::method_name(config.crossover);
+    return crossover::method_name(config.format == encoding::format::bgra ? crossover::method::single_point : crossover::method::pixel);
+}
+
+static void write_csv_string(std::FILE* file, const std::string& text) {
+    std::fputc('"', file);
+    for (const char c : text) {
+        if (c == '"')
+            std::fputc('"', file);
+        std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+static void write_json_string(std::FILE* file, const std::string& text) {
+    std::fputc('"', file);
+    for (const char c : text) {
+        if (c == '"' || c == '\\')
+            std::fprintf(file, "\\%c", c);
+        else if (static_cast<unsigned char>(c) < 0x20)
+            std::fprintf(file, "\\u%04x", c);
+        else
+            std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+// Infinite quantiles are written as "inf" in CSV and null in JSON.
+static void write_number(std::FILE* file, const double value, const char* infinite) {
+    if (std::isinf(value))
+        std::fputs(infinite, file);
+    else
+        std::fprintf(file, "%.6g", value);
+}
+
+static bool write_csv(const std::filesystem::path& path, const std::vector<convergence::summary>& summaries) {
+    std::FILE* file = std::fopen(path.string().c_str(), "w");
+    if (!file)
+        return false;
+
+    std::fprintf(file, "name,target,algorithm,mode,selection,crossover,target_fitness,runs,reached,failed,median_seconds,p90_seconds,median_evaluations,p90_evaluations,median_fitness,worst_fitness,best_fitness\n");
+    for (const convergence::summary& row : summaries) {
+        write_csv_string(file, row.config.name);
+        std::fputc(',', file);
+        write_csv_string(file, row.config.target_path);
+        std::fprintf(file, ",%s,%s,%s,%s,%.6f,%u,%u,%u,", batch::algorithm_name(row.config.kind), batch::format_name(row.config.format),
+            selection_name(row.config), crossover_name(row.config), row.target_fitness, row.runs, row.reached, row.failed);
+        for (const double value : { row.median_seconds, row.p90_seconds, row.median_evaluations, row.p90_evaluations }) {
+            write_number(file, value, "inf");
+            std::fputc(',', file);
+        }
+        std::fprintf(file, "%.6f,%.6f,%.6f\n", row.median_fitness, row.worst_fitness, row.best_fitness);
+    }
+    std::fclose(file);
+    return true;
+}
+
+static bool write_json(const std::filesystem::path& path, const std::vector<convergence::summary>& summaries) {
+    std::FILE* file = std::fopen(path.string().c_str(), "w");
+    if (!file)
+        return false;
+
+    std::fprintf(file, "[\n");
+    for (size_t i = 0; i < summaries.size(); ++i) {
+        const convergence::summary& row = summaries[i];
+        std::fprintf(file, "  {\"name\": ");
+        write_json_string(file, row.config.name);
+        std::fprintf(file, ", \"target\": ");
+        write_json_string(file, row.config.target_path);
+        std::fprintf(file, ", \"algorithm\": \"%s\", \"mode\": \"%s\", \"selection\": \"%s\", \"crossover\": \"%s\", \"target_fitness\": %.6f, \"seed\": %" PRIu64 ", \"runs\": %u, \"reached\": %u, \"failed\": %u",
+            batch::algorithm_name(row.config.kind), batch::format_name(row.config.format), selection_name(row.config), crossover_name(row.config),
+            row.target_fitness, row.config.seed, row.runs, row.reached, row.failed);
+
+        const std::pair<const char*, double> quantiles[] = {
+            { "median_seconds", row.median_seconds }, { "p90_seconds", row.p90_seconds },
+            { "median_evaluations", row.median_evaluations }, { "p90_evaluations", row.p90_evaluations }
+        };
+        for (const auto& [key, value] : quantiles) {
+            std::fprintf(file, ", \"%s\": ", key);
+            write_number(file, value, "null");
+        }
+        std::fprintf(file, ", \"median_fitness\": %.6f, \"worst_fitness\": %.6f, \"best_fitness\": %.6f}%s\n",
+            row.median_fitness, row.worst_fitness, row.best_fitness, i + 1 < summaries.size() ? "," : "");
+    }
+    std::fprintf(file, "]\n");
+    std::fclose(file);
+    return true;
+}
+
+bool convergence::run(const std::vector<batch::job>& configs, const unsigned int runs, const unsigned int threads, const std::string& output_directory, std::vector<summary>& summaries, const batch::finished_callback on_finished, const std::stop_token stop, std::string& error) {
+    const unsigned int count = std::max(runs, 1U);
+
+    std::vector<batch::job> jobs;
+    jobs.reserve(configs.size() * count);
+    for (const batch::job& config : configs) {
+        for (unsigned int n = 0; n < count; ++n) {
+            batch::job work = config;
+            char suffix[16];
+            std::snprintf(suffix, sizeof(suffix), "-run%03u", n);
+            work.name += suffix;
+            work.seed = rng::derive_seed(config.seed, n);
+            jobs.push_back(std::move(work));
+        }
+    }
+
+    const std::filesystem::path directory(output_directory);
+    std::vector<batch::job_result> results;
+    if (!batch::run(jobs, threads, (directory / "runs").string(), results, on_finished, stop, error))
+        return false;
+
+    summaries.clear();
+    for (size_t i = 0; i < configs.size(); ++i)
+        summaries.push_back(summarize(configs[i], results, i * count, count));
+
+    if (!write_csv(directory / "convergence.csv", summaries)) {
+        error = "cannot write '" + (directory / "convergence.csv").string() + "'";
+        return false;
+    }
+    if (!write_json(directory / "convergence.json", summaries)) {
+        error = "cannot write '" + (directory / "convergence.json").string() + "'";
+        return false;
+    }
+    return true;
+}
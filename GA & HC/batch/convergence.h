@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <stop_token>
+#include <string>
+#include <vector>
+#include "batch.h"
+
+// Time-to-target comparison: every manifest line is a configuration that is
+// run several times with different seeds, and the runs are summarized as
+// quantiles of the time and fitness evaluations it took to reach the target
+// fitness.
+namespace convergence {
+    struct summary {
+        batch::job config;
+        float target_fitness = 0.f;
+        unsigned int runs = 0;
+        unsigned int reached = 0;
+        // Runs that failed or were stopped; they are left out of the statistics.
+        unsigned int failed = 0;
+        // Nearest-rank quantiles over the completed runs. A run that missed
+        // the target counts as never reaching it, so a quantile it falls in
+        // is infinite.
+        double median_seconds = 0.0;
+        double p90_seconds = 0.0;
+        double median_evaluations = 0.0;
+        double p90_evaluations = 0.0;
+        float median_fitness = 0.f;
+        float worst_fitness = 0.f;
+        float best_fitness = 0.f;
+    };
+
+    // Fitness evaluations a run made: a GA scores its initial population and
+    // every generation, a climber one neighbour per iteration after scoring
+    // its starting point.
+    uint64_t evaluations(const batch::job& work, const batch::job_result& result);
+
+    // Runs every config `runs` times, seeded from the config's own seed,
+    // through batch::run into <output_directory>/runs, then writes one row per
+    // config to convergence.csv and convergence.json in output_directory.
+    bool run(const std::vector<batch::job>& configs, unsigned int runs, unsigned int threads, const std::string& output_directory, std::vector<summary>& summaries, batch::finished_callback on_finished, std::stop_token stop, std::string& error);
+}
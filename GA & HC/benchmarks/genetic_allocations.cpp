@@ -0,0 +1,93 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+#include "../genetic/genetic.h"
+
+static std::atomic<size_t> allocation_count{ 0 };
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Population genomes come from aligned_allocator. The array and nothrow forms
+// forward to these by default, so they are counted too.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t bytes = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+    if (void* ptr = _aligned_malloc(size ? size : 1, bytes))
+        return ptr;
+#else
+    // aligned_alloc wants a multiple of the alignment.
+    if (void* ptr = std::aligned_alloc(bytes, ((size ? size : 1) + bytes - 1) / bytes * bytes))
+        return ptr;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    operator delete(ptr, alignment);
+}
+
+// Runs a worker for `generations` more generations on the calling thread.
+template <typename WorkerFunc>
+static void run_generations(std::atomic<bool>& running, std::atomic<unsigned int>& generation, unsigned int generations, WorkerFunc worker_func) {
+    genetic_algorithm::max_generations = generation + generations;
+    running = true;
+    worker_func(std::stop_token{});
+}
+
+template <typename WorkerFunc>
+static void measure(const char* name, unsigned int generations, std::atomic<bool>& running, std::atomic<unsigned int>& generation, WorkerFunc worker_func) {
+    // Warm-up so the best genome's first copy is not counted.
+    run_generations(running, generation, 10, worker_func);
+
+    const unsigned int generation_before = generation;
+    const size_t allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+
+    run_generations(running, generation, generations, worker_func);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const size_t allocations = allocation_count.load() - allocations_before;
+    const unsigned int ran = generation - generation_before;
+
+    std::printf("%-8s %6u generations | %8.4f allocations/generation | %10.1f us/generation\n",
+        name, ran, ran ? static_cast<double>(allocations) / ran : 0.0, ran ? seconds * 1e6 / ran : 0.0);
+}
+
+int main(int argc, char** argv) {
+    const unsigned int generations = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 400U;
+
+    genetic_algorithm::initialize();
+
+    measure("color", generations, genetic_algorithm::color_running, genetic_algorithm::color_generation, genetic_algorithm::color_worker);
+    measure("gray", generations, genetic_algorithm::gray_scale_running, genetic_algorithm::gray_scale_generation, genetic_algorithm::gray_scale_worker);
+    measure("binary", generations, genetic_algorithm::binary_running, genetic_algorithm::binary_generation, genetic_algorithm::binary_worker);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+#include "../engine/modes.h"
+#include "../hill_climbing/hill_climbing.h"
+#include "../utilities/instrument.h"
+#include "../utilities/random.h"
+
+static std::atomic<size_t> allocation_count{ 0 };
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// For over-aligned types; the array and nothrow forms forward to these by
+// default, so they are counted too.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t bytes = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+    if (void* ptr = _aligned_malloc(size ? size : 1, bytes))
+        return ptr;
+#else
+    // aligned_alloc wants a multiple of the alignment.
+    if (void* ptr = std::aligned_alloc(bytes, ((size ? size : 1) + bytes - 1) / bytes * bytes))
+        return ptr;
+#endif
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+    operator delete(ptr, alignment);
+}
+
+template <typename Mode>
+static bool copy_step(individual& current) {
+    mutation_log log;
+    individual neighbor = current;
+    Mode::mutate(neighbor.genome, random_float(0.00001f, 0.001f), globals::target.pixel_count(), modes::record{ log });
+    const float neighbor_fitness = modes::fitness<Mode>(neighbor.genome, globals::target);
+
+    if (neighbor_fitness > current.fitness) {
+        current = neighbor;
+        current.fitness = neighbor_fitness;
+        return true;
+    }
+    return false;
+}
+
+template <typename StepFunc>
+static void measure(const char* name, unsigned int iterations, StepFunc step_func) {
+    // Warm-up so one-time growth (e.g. the log reaching its working size) is not counted.
+    for (unsigned int i = 0; i < 1000; ++i)
+        step_func();
+
+    const size_t allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+
+    unsigned int accepted = 0;
+    for (unsigned int i = 0; i < iterations; ++i)
+        accepted += step_func() ? 1 : 0;
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const size_t allocations = allocation_count.load() - allocations_before;
+
+    std::printf("%-22s %10u iterations | %8.4f allocations/iteration | %10.1f ns/iteration | %u accepted\n",
+        name, iterations, static_cast<double>(allocations) / iterations, seconds * 1e9 / iterations, accepted);
+}
+
+// Runs a worker for `iterations` more iterations on the calling thread, best
+// and publish bookkeeping included. Every call starts from a random individual
+// and reserves the worker's mutation log, one allocation per run.
+template <typename WorkerFunc>
+static void run_iterations(std::atomic<bool>& running, std::atomic<unsigned int>& generation, unsigned int iterations, WorkerFunc worker_func) {
+    hill_climbing::max_iterations = generation + iterations;
+    running = true;
+    worker_func(std::stop_token{});
+}
+
+template <typename WorkerFunc>
+static void measure_worker(const char* name, unsigned int iterations, std::atomic<bool>& running, std::atomic<unsigned int>& generation, WorkerFunc worker_func) {
+    run_iterations(running, generation, 1000, worker_func);
+
+    const unsigned int generation_before = generation;
+    const size_t allocations_before = allocation_count.load();
+    instrument::reset();
+    const auto start = std::chrono::steady_clock::now();
+
+    run_iterations(running, generation, iterations, worker_func);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const size_t allocations = allocation_count.load() - allocations_before;
+    const unsigned int ran = generation - generation_before;
+    const instrument::snapshot stats = instrument::collect();
+
+    std::printf("%-22s %10u iterations | %8.4f allocations/iteration | %10.1f ns/iteration",
+        name, ran, ran ? static_cast<double>(allocations) / ran : 0.0, ran ? seconds * 1e9 / ran : 0.0);
+    // Genome copies into best are only counted in instrumented builds.
+    if (instrument::enabled) {
+        std::printf(" | %u improvements, %llu copies", static_cast<unsigned int>(stats.all.events[static_cast<size_t>(instrument::event::improvements)]),
+            static_cast<unsigned long long>(stats.all.calls[static_cast<size_t>(instrument::phase::copy)]));
+    }
+    std::printf("\n");
+}
+
+int main(int argc, char** argv) {
+    const unsigned int iterations = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 20'000U;
+
+    hill_climbing::initialize();
+
+    mutation_log log;
+    log.reserve(hill_climbing::mutation_log_capacity);
+
+    individual copy_current = hill_climbing::color_current;
+    measure("color copy-per-step", iterations, [&] {
+        return copy_step<modes::color>(copy_current);
+    });
+    measure("color in-place", iterations, [&] {
+        return hill_climbing::step_color(hill_climbing::color_current, log, globals::target);
+    });
+    measure_worker("color worker", iterations, hill_climbing::color_running, hill_climbing::color_generation, hill_climbing::color_worker);
+
+    copy_current = hill_climbing::gray_scale_current;
+    measure("gray copy-per-step", iterations, [&] {
+        return copy_step<modes::gray>(copy_current);
+    });
+    measure("gray in-place", iterations, [&] {
+        return hill_climbing::step_gray_scale(hill_climbing::gray_scale_current, log, globals::target);
+    });
+    measure_worker("gray worker", iterations, hill_climbing::gray_scale_running, hill_climbing::gray_scale_generation, hill_climbing::gray_scale_worker);
+
+    copy_current = hill_climbing::binary_current;
+    measure("binary copy-per-step", iterations, [&] {
+        return copy_step<modes::binary>(copy_current);
+    });
+    measure("binary in-place", iterations, [&] {
+        return hill_climbing::step_binary(hill_climbing::binary_current, log, globals::target);
+    });
+    measure_worker("binary worker", iterations, hill_climbing::binary_running, hill_climbing::binary_generation, hill_climbing::binary_worker);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../engine/modes.h"
+#include "../genetic/crossover.h"
+#include "../genetic/genetic.h"
+#include "../hill_climbing/hill_climbing.h"
+#include "../kernels/fitness_kernels.h"
+#include "../utilities/random.h"
+
+// Throughput of the engine's hot paths for every mode over a range of image
+// sizes: fitness evaluations, mutations and crossovers per genome, and whole
+// GA generations and hill-climbing iterations. Results are written as JSON
+// so they can be compared from commit to commit.
+
+struct image_size {
+    unsigned int width;
+    unsigned int height;
+};
+
+struct options {
+    std::vector<image_size> sizes{ { 44, 60 }, { 320, 240 }, { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+    // Seconds each measurement runs for at least.
+    double min_time = 0.2;
+    bool loops = true;
+    std::string output;
+    std::string label;
+};
+
+struct result {
+    image_size size;
+    const char* mode;
+    const char* benchmark;
+    // Crossover method, empty otherwise.
+    const char* variant;
+    double value;
+    const char* unit;
+};
+
+// Keeps the compiler from dropping work whose result is otherwise unused.
+static volatile uint64_t sink = 0;
+
+using benchmark_clock = std::chrono::steady_clock;
+
+static double seconds_since(const benchmark_clock::time_point start) {
+    return std::chrono::duration<double>(benchmark_clock::now() - start).count();
+}
+
+// Calls func in growing batches until a batch takes min_time; returns seconds per call.
+template <typename Func>
+static double seconds_per_call(const double min_time, Func func) {
+    size_t calls = 1;
+    for (;;) {
+        const auto start = benchmark_clock::now();
+        for (size_t i = 0; i < calls; ++i)
+            func();
+        const double seconds = seconds_since(start);
+        if (seconds >= min_time)
+            return seconds / static_cast<double>(calls);
+
+        const double scale = seconds > 0.0 ? 1.2 * min_time / seconds : 10.0;
+        calls = std::max(calls * 2, static_cast<size_t>(static_cast<double>(calls) * std::min(scale, 100.0)));
+    }
+}
+
+// Steps per second of run(steps), which also does setup that takes as long
+// for every step count: the setup time is cancelled out by subtracting a
+// one-step run.
+template <typename RunFunc>
+static double steps_per_second(const double min_time, RunFunc run) {
+    auto start = benchmark_clock::now();
+    run(1U);
+    const double baseline = seconds_since(start);
+
+    unsigned int steps = 2;
+    for (;;) {
+        start = benchmark_clock::now();
+        run(1U + steps);
+        const double seconds = seconds_since(start) - baseline;
+        if (seconds >= min_time || steps >= (1U << 30))
+            return seconds > 0.0 ? steps / seconds : 0.0;
+
+        const double scale = seconds > 0.0 ? 1.2 * min_time / seconds : 10.0;
+        steps = std::max(steps * 2, static_cast<unsigned int>(steps * std::min(scale, 100.0)));
+    }
+}
+
+static void random_genome(std::vector<uint8_t>& genome, const encoding::format format, const size_t pixel_count) {
+    random_bytes(genome.data(), genome.size());
+    if (format == encoding::format::bits)
+        encoding::clear_padding(genome.data(), pixel_count);
+}
+
+template <typename Mode>
+static void measure_mode(const options& settings, const image_size size, const globals::target_image& target, const char* mode_name, std::vector<result>& results) {
+    const size_t pixel_count = target.pixel_count();
+    const size_t genome_size = Mode::genome_size(pixel_count);
+    std::vector<uint8_t> parent1(genome_size), parent2(genome_size), offspring(genome_size);
+    random_genome(parent1, Mode::format, pixel_count);
+    random_genome(parent2, Mode::format, pixel_count);
+
+    const auto add = [&](const char* benchmark, const char* variant, const double value, const char* unit) {
+        results.push_back({ size, mode_name, benchmark, variant, value, unit });
+        std::fprintf(stderr, "%5ux%-5u %-7s %-10s %-13s %14.1f %s\n", size.width, size.height, mode_name, benchmark, variant, value, unit);
+    };
+
+    add("fitness", "", 1e9 * seconds_per_call(settings.min_time, [&] {
+        sink = sink + static_cast<uint64_t>(modes::fitness<Mode>(parent1, target) * 1e6f);
+    }), "ns/eval");
+
+    // The GA draws its mutation rate from [0.00001, 0.001]; this is the middle.
+    add("mutation", "", 1e9 * seconds_per_call(settings.min_time, [&] {
+        Mode::mutate(parent1, 0.0005f, pixel_count, modes::discard{});
+    }), "ns/genome");
+
+    for (const crossover::method method : { crossover::method::single_point, crossover::method::two_point, crossover::method::uniform, crossover::method::pixel, crossover::method::block }) {
+        const crossover::config config{ method };
+        add("crossover", crossover::method_name(method), 1e9 * seconds_per_call(settings.min_time, [&] {
+            crossover::apply(config, Mode::format, parent1, parent2, offspring, target.width, target.height);
+        }), "ns/genome");
+    }
+
+    if (!settings.loops)
+        return;
+
+    // Single-threaded runs of each algorithm's worker loop; an unreachable
+    // target fitness keeps them going for the whole budget.
+    {
+        genetic_algorithm::run_config config;
+        config.format = Mode::format;
+        config.target_fitness = 2.f;
+        config.seed = 1;
+        genetic_algorithm::run_state state;
+        add("generation", "", steps_per_second(settings.min_time, [&](const unsigned int generations) {
+            config.max_generations = generations;
+            genetic_algorithm::run(target, config, state);
+        }), "generations/s");
+    }
+    {
+        hill_climbing::run_config config;
+        config.format = Mode::format;
+        config.target_fitness = 2.f;
+        config.seed = 1;
+        hill_climbing::run_state state;
+        add("iteration", "", steps_per_second(settings.min_time, [&](const unsigned int iterations) {
+            config.max_iterations = iterations;
+            hill_climbing::run(target, config, state);
+        }), "iterations/s");
+    }
+}
+
+static const char* rng_name() {
+#if defined(GA_HC_RNG_PCG64)
+    return "pcg64";
+#elif defined(GA_HC_RNG_WYRAND)
+    return "wyrand";
+#else
+    return "xoshiro256pp";
+#endif
+}
+
+static void write_json_string(FILE* out, const std::string& value) {
+    std::fputc('"', out);
+    for (const char c : value) {
+        if (c == '"' || c == '\\')
+            std::fprintf(out, "\\%c", c);
+        else if (static_cast<unsigned char>(c) < 0x20)
+            std::fprintf(out, "\\u%04x", c);
+        else
+            std::fputc(c, out);
+    }
+    std::fputc('"', out);
+}
+
+static void write_json(FILE* out, const options& settings, const std::vector<result>& results) {
+    std::fprintf(out, "{\n  \"benchmark\": \"ga_hc_throughput\",\n  \"label\": ");
+    write_json_string(out, settings.label);
+    std::fprintf(out, ",\n  \"isa\": \"%s\",\n  \"rng\": \"%s\",\n  \"min_time\": %g,\n  \"results\": [\n",
+        kernels::isa_name(kernels::active_isa()), rng_name(), settings.min_time);
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const result& entry = results[i];
+        std::fprintf(out, "    {\"width\": %u, \"height\": %u, \"pixels\": %zu, \"mode\": \"%s\", \"benchmark\": \"%s\", \"variant\": \"%s\", \"value\": %.6g, \"unit\": \"%s\"}%s\n",
+            entry.size.width, entry.size.height, static_cast<size_t>(entry.size.width) * entry.size.height, entry.mode, entry.benchmark, entry.variant, entry.value, entry.unit, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+static bool parse_sizes(const char* text, std::vector<image_size>& sizes) {
+    sizes.clear();
+    while (*text) {
+        unsigned int width = 0, height = 0;
+        int consumed = 0;
+        if (std::sscanf(text, "%ux%u%n", &width, &height, &consumed) != 2 || width == 0 || height == 0)
+            return false;
+        sizes.push_back({ width, height });
+        text += consumed;
+        if (*text == ',')
+            ++text;
+        else if (*text)
+            return false;
+    }
+    return !sizes.empty();
+}
+
+static void print_usage(const char* program) {
+    std::printf(
+        "usage: %s [options]\n"
+        "  --sizes <WxH,...>     image sizes to measure (default: 44x60,320x240,1280x720,1920x1080,3840x2160)\n"
+        "  --min-time <seconds>  minimum duration of every measurement (default: 0.2)\n"
+        "  --no-loops            skip the GA generation and hill-climbing iteration loops\n"
+        "  --label <text>        stored in the JSON, e.g. a commit hash\n"
+        "  --output <file>       write the JSON there instead of to stdout\n"
+        "  --help                show this message\n", program);
+}
+
+int main(int argc, char** argv) {
+    options settings;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--sizes" && has_value) {
+            if (!parse_sizes(argv[++i], settings.sizes)) {
+                std::fprintf(stderr, "invalid sizes '%s'\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (arg == "--min-time" && has_value) {
+            settings.min_time = std::atof(argv[++i]);
+        }
+        else if (arg == "--no-loops") {
+            settings.loops = false;
+        }
+        else if (arg == "--label" && has_value) {
+            settings.label = argv[++i];
+        }
+        else if (arg == "--output" && has_value) {
+            settings.output = argv[++i];
+        }
+        else if (arg == "--help") {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else {
+            std::fprintf(stderr, "unknown option '%s'\n", arg.c_str());
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    rng::seed_thread(rng::derive_seed(0x5EED, 0));
+
+    std::vector<result> results;
+    for (const image_size size : settings.sizes) {
+        std::vector<uint8_t> bgra(static_cast<size_t>(size.width) * size.height * 4);
+        random_bytes(bgra.data(), bgra.size());
+        const globals::target_image target = globals::make_target(size.width, size.height, bgra.data());
+
+        measure_mode<modes::color>(settings, size, target, "color", results);
+        measure_mode<modes::gray>(settings, size, target, "gray", results);
+        measure_mode<modes::binary>(settings, size, target, "binary", results);
+    }
+
+    FILE* out = stdout;
+    if (!settings.output.empty()) {
+        out = std::fopen(settings.output.c_str(), "w");
+        if (!out) {
+            std::fprintf(stderr, "cannot write '%s'\n", settings.output.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    write_json(out, settings, results);
+    if (out != stdout)
+        std::fclose(out);
+    return EXIT_SUCCESS;
+}
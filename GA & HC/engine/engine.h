@@ -0,0 +1,72 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <stop_token>
+#include "../telemetry/telemetry.h"
+#include "../utilities/cancellation.h"
+#include "../utilities/instrument.h"
+#include "../utilities/throttle.h"
+
+// The loop every worker runs, templated on a mode (engine/modes.h) and a
+// search strategy instantiated for it. The loop owns what the algorithms
+// share: stop requests, the target fitness and step budget, the CPU budget,
+// telemetry sampling and signalling that the worker finished. A Strategy<Mode>
+// provides
+//   static constexpr telemetry::algorithm algorithm;
+//   unsigned int check_interval() const;  steps between throttle checks
+//   unsigned int threads() const;         threads it keeps busy, itself included
+//   unsigned int sample_interval() const; steps between telemetry samples
+//   bool advance();            takes one step (a GA generation, a climbing
+//                              iteration); false if a stop cut it short
+//   bool prepare();            gets ready for the next step once the run goes
+//                              on; false if a stop cut it short
+//   unsigned int steps() const;
+//   float best_fitness() const;
+//   bool done() const;         a stop of its own, e.g. another climber
+//                              reached the target first
+//   void sample(telemetry::recorder&);
+//   void finish();             publishes its final state
+namespace engine {
+    struct loop_config {
+        float target_fitness = 1.f;
+        // 0 = no limit.
+        unsigned int max_steps = 0;
+        telemetry::log* samples = nullptr;
+        // Island or climber index, for telemetry.
+        size_t worker = 0;
+    };
+
+    template <typename Mode, template <typename> typename Strategy>
+    void run(Strategy<Mode>& strategy, const loop_config& config, const std::stop_token& stop, std::atomic<bool>& running) {
+        throttle::limiter limiter(strategy.check_interval(), strategy.threads(), stop);
+        telemetry::recorder recorder(config.samples, Strategy<Mode>::algorithm, Mode::format, config.worker);
+        const unsigned int sample_interval = std::max(strategy.sample_interval(), 1U);
+        unsigned int sampled = strategy.steps();
+
+        while (!stop.stop_requested()) {
+            if (!strategy.advance())
+                break;
+
+            const unsigned int steps = strategy.steps();
+            if (recorder && steps % sample_interval == 0) {
+                strategy.sample(recorder);
+                sampled = steps;
+            }
+
+            if (strategy.best_fitness() >= config.target_fitness || (config.max_steps && steps >= config.max_steps) || strategy.done())
+                break;
+            if (!strategy.prepare())
+                break;
+
+            GA_HC_TIME(throttle);
+            limiter.step();
+        }
+
+        strategy.finish();
+        if (recorder && strategy.steps() != sampled)
+            strategy.sample(recorder);
+
+        running.store(false);
+        cancellation::worker_finished.notify();
+    }
+}
@@ -0,0 +1,161 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "../target.h"
+#include "../kernels/fitness_kernels.h"
+#include "../utilities/encoding.h"
+#include "../utilities/individual.h"
+#include "../utilities/random.h"
+
+// The three evolution modes as policy types: genome layout, error, fitness
+// and mutation of each, shared by the genetic algorithm and hill climbing.
+// Workers are templates on a mode, so every call here is resolved at compile
+// time and inlined into the mode's loops, and a change lands in both
+// algorithms at once.
+namespace modes {
+    // Mutation hooks, called with (gene index, old value) before a gene changes.
+    struct discard {
+        void operator()(size_t, uint8_t) const {}
+    };
+
+    struct record {
+        mutation_log& log;
+
+        void operator()(const size_t index, const uint8_t old_value) const {
+            log.push_back({ static_cast<uint32_t>(index), old_value });
+        }
+    };
+
+    inline uint64_t abs_diff(const uint8_t a, const uint8_t b) {
+        return a > b ? a - b : b - a;
+    }
+
+    // Modes with one byte per gene and Channels genes per pixel, compared
+    // with the byte plane Mode::reference() of the target.
+    template <typename Mode, size_t Channels>
+    struct byte_genes {
+        static constexpr size_t channels = Channels;
+
+        static constexpr size_t genome_size(const size_t pixel_count) {
+            return pixel_count * Channels;
+        }
+
+        static uint64_t error(const uint8_t* genome, const globals::target_image& target) {
+            const std::span<const uint8_t> reference = Mode::reference(target);
+            return kernels::sum_abs_diff(genome, reference.data(), reference.size());
+        }
+
+        // Error of genome from the error it had before the changes in log.
+        static uint64_t update_error(uint64_t error, const uint8_t* genome, const mutation_log& log, const globals::target_image& target) {
+            const uint8_t* reference = Mode::reference(target).data();
+            for (const auto& change : log) {
+                error -= abs_diff(change.old_value, reference[change.index]);
+                error += abs_diff(genome[change.index], reference[change.index]);
+            }
+            return error;
+        }
+
+        template <typename Changed>
+        static void mutate(std::span<uint8_t> genome, const float mutation_rate, size_t, Changed changed) {
+            for_each_sampled(genome.size(), mutation_rate, [&](const size_t i) {
+                changed(i, genome[i]);
+                genome[i] = random_int(0, 255);
+            });
+        }
+
+        static void undo(uint8_t* genome, const mutation_log& log) {
+            for (auto it = log.rbegin(); it != log.rend(); ++it)
+                genome[it->index] = it->old_value;
+        }
+    };
+
+    struct color : byte_genes<color, 4> {
+        static constexpr encoding::format format = encoding::format::bgra;
+
+        static std::span<const uint8_t> reference(const globals::target_image& target) {
+            return target.bgra;
+        }
+
+        static float fitness(const uint64_t error, const globals::target_image& target) {
+            double total_fitness = static_cast<double>(error);
+
+            total_fitness /= target.bgra.size();
+            return static_cast<float>(1.0 - (total_fitness / 255.0));
+        }
+    };
+
+    struct gray : byte_genes<gray, 1> {
+        static constexpr encoding::format format = encoding::format::luma;
+
+        static std::span<const uint8_t> reference(const globals::target_image& target) {
+            return target.luma_plane;
+        }
+
+        static float fitness(const uint64_t error, const globals::target_image& target) {
+            const size_t bitmap_size = target.luma_plane.size();
+            return static_cast<float>(1.0 - (static_cast<double>(error) / (bitmap_size * 255.0)));
+        }
+    };
+
+    // One bit per pixel; genes are pixels and mutating one flips it.
+    struct binary {
+        static constexpr encoding::format format = encoding::format::bits;
+
+        static constexpr size_t genome_size(const size_t pixel_count) {
+            return encoding::genome_size(format, pixel_count);
+        }
+
+        static uint64_t error(const uint8_t* genome, const globals::target_image& target) {
+            return kernels::count_bit_differences(genome, target.binary_bits(), genome_size(target.pixel_count()));
+        }
+
+        static uint64_t update_error(uint64_t error, const uint8_t* genome, const mutation_log& log, const globals::target_image& target) {
+            const uint8_t* reference = target.binary_bits();
+            for (const auto& change : log) {
+                const bool expected = encoding::get_bit(reference, change.index);
+                error -= (change.old_value != 0) != expected;
+                error += encoding::get_bit(genome, change.index) != expected;
+            }
+            return error;
+        }
+
+        static float fitness(const uint64_t error, const globals::target_image& target) {
+            const size_t bitmap_size = target.luma_plane.size();
+            return static_cast<float>(static_cast<float>(bitmap_size - error) / static_cast<float>(bitmap_size));
+        }
+
+        template <typename Changed>
+        static void mutate(std::span<uint8_t> genome, const float mutation_rate, const size_t pixel_count, Changed changed) {
+            for_each_sampled(pixel_count, mutation_rate, [&](const size_t pixel) {
+                changed(pixel, encoding::get_bit(genome.data(), pixel));
+                encoding::flip_bit(genome.data(), pixel);
+            });
+        }
+
+        static void undo(uint8_t* genome, const mutation_log& log) {
+            for (auto it = log.rbegin(); it != log.rend(); ++it) {
+                if (encoding::get_bit(genome, it->index) != (it->old_value != 0))
+                    encoding::flip_bit(genome, it->index);
+            }
+        }
+    };
+
+    static_assert(color::genome_size(3) == encoding::genome_size(color::format, 3));
+    static_assert(gray::genome_size(3) == encoding::genome_size(gray::format, 3));
+
+    template <typename Mode>
+    float fitness(std::span<const uint8_t> genome, const globals::target_image& target) {
+        return Mode::fitness(Mode::error(genome.data(), target), target);
+    }
+
+    // Calls func with the mode policy (a value of it) for format.
+    template <typename Func>
+    decltype(auto) visit(const encoding::format format, Func&& func) {
+        switch (format) {
+        case encoding::format::luma: return func(gray{});
+        case encoding::format::bits: return func(binary{});
+        default: return func(color{});
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#include "crossover.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+#include "../kernels/fitness_kernels.h"
+#include "../utilities/random.h"
+
+// Selection mask for the calling thread; grows to the genome size once.
+static std::span<uint8_t> mask_buffer(const size_t size) {
+    static thread_local std::vector<uint8_t> mask;
+    if (mask.size() < size)
+        mask.resize(size);
+    return { mask.data(), size };
+}
+
+// Mask bytes for 8 pixels (32 bytes) per value of a random byte, one bit per pixel.
+static const auto pixel_mask_table = [] {
+    std::array<std::array<uint8_t, 32>, 256> table{};
+    for (size_t bits = 0; bits < 256; ++bits) {
+        for (size_t pixel = 0; pixel < 8; ++pixel) {
+            const uint8_t select = ((bits >> pixel) & 1) ? 0xFF : 0x00;
+            std::fill_n(table[bits].begin() + pixel * 4, 4, select);
+        }
+    }
+    return table;
+}();
+
+static void build_pixel_mask(std::span<uint8_t> mask) {
+    const size_t pixel_count = mask.size() / 4;
+    uint64_t bits = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= pixel_count; i += 8) {
+        if (i % 64 == 0)
+            bits = rng::thread_engine()();
+        std::memcpy(mask.data() + i * 4, pixel_mask_table[(bits >> (i % 64)) & 0xFF].data(), 32);
+    }
+
+    if (i < pixel_count) {
+        if (i % 64 == 0)
+            bits = rng::thread_engine()();
+        std::memcpy(mask.data() + i * 4, pixel_mask_table[(bits >> (i % 64)) & 0xFF].data(), (pixel_count - i) * 4);
+    }
+}
+
+// Tiles of tile_bytes x block_rows in rows of row_bytes, each taken from either parent.
+static void build_block_mask(std::span<uint8_t> mask, const size_t row_bytes, const size_t tile_bytes, const size_t block_rows) {
+    const size_t height = mask.size() / row_bytes;
+    const size_t tiles_x = (row_bytes + tile_bytes - 1) / tile_bytes;
+
+    uint64_t bits = 0;
+    for (size_t tile_y = 0; tile_y * block_rows < height; ++tile_y) {
+        uint8_t* row = mask.data() + tile_y * block_rows * row_bytes;
+
+        // Build the tile row's first pixel row, then repeat it for the rest of the tile.
+        for (size_t tile_x = 0; tile_x < tiles_x; ++tile_x) {
+            const size_t tile = tile_y * tiles_x + tile_x;
+            if (tile % 64 == 0)
+                bits = rng::thread_engine()();
+
+            const size_t begin = tile_x * tile_bytes;
+            const size_t end = std::min(begin + tile_bytes, row_bytes);
+            std::memset(row + begin, ((bits >> (tile % 64)) & 1) ? 0xFF : 0x00, end - begin);
+        }
+
+        const size_t rows = std::min(block_rows, height - tile_y * block_rows);
+        for (size_t y = 1; y < rows; ++y)
+            std::memcpy(row + y * row_bytes, row, row_bytes);
+    }
+}
+
+// Sets bits [begin, end) of a bit mask.
+static void set_bit_range(uint8_t* mask, size_t begin, const size_t end) {
+    while (begin < end) {
+        if (begin % 8 == 0 && begin + 8 <= end) {
+            mask[begin / 8] = 0xFF;
+            begin += 8;
+        }
+        else {
+            mask[begin / 8] |= static_cast<uint8_t>(1U << (begin % 8));
+            ++begin;
+        }
+    }
+}
+
+static void blend_bits(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, const size_t size) {
+    for (size_t i = 0; i < size; ++i)
+        out[i] = static_cast<uint8_t>(a[i] ^ ((a[i] ^ b[i]) & mask[i]));
+}
+
+// Binary genomes: the same operators on a one bit per pixel mask.
+static void apply_bits(const crossover::config& settings, std::span<const uint8_t> parent1, std::span<const uint8_t> parent2, std::span<uint8_t> offspring, const size_t width, const size_t height) {
+    using crossover::method;
+
+    const size_t size = parent1.size();
+    const size_t pixel_count = width * height;
+    const auto mask = mask_buffer(size);
+
+    switch (settings.kind) {
+    case method::single_point:
+        std::memset(mask.data(), 0, size);
+        set_bit_range(mask.data(), random_int(0, static_cast<int>(pixel_count) - 1), size * 8);
+        break;
+    case method::two_point: {
+        size_t first = random_int(0, static_cast<int>(pixel_count) - 1);
+        size_t second = random_int(0, static_cast<int>(pixel_count) - 1);
+        if (first > second)
+            std::swap(first, second);
+        std::memset(mask.data(), 0, size);
+        set_bit_range(mask.data(), first, second);
+        break;
+    }
+    case method::uniform:
+    case method::pixel:
+        random_bytes(mask.data(), size);
+        break;
+    case method::block: {
+        const size_t block_size = std::max(settings.block_size, 1U);
+        const size_t tiles_x = (width + block_size - 1) / block_size;
+        std::memset(mask.data(), 0, size);
+
+        uint64_t bits = 0;
+        for (size_t tile_y = 0; tile_y * block_size < height; ++tile_y) {
+            for (size_t tile_x = 0; tile_x < tiles_x; ++tile_x) {
+                const size_t tile = tile_y * tiles_x + tile_x;
+                if (tile % 64 == 0)
+                    bits = rng::thread_engine()();
+                if (!((bits >> (tile % 64)) & 1))
+                    continue;
+
+                const size_t x = tile_x * block_size;
+                const size_t tile_width = std::min(block_size, width - x);
+                for (size_t y = tile_y * block_size; y < std::min((tile_y + 1) * block_size, height); ++y)
+                    set_bit_range(mask.data(), y * width + x, y * width + x + tile_width);
+            }
+        }
+        break;
+    }
+    }
+
+    blend_bits(parent1.data(), parent2.data(), mask.data(), offspring.data(), size);
+}
+
+void crossover::apply(const config& settings, const encoding::format format, std::span<const uint8_t> parent1, std::span<const uint8_t> parent2, std::span<uint8_t> offspring, const size_t width, const size_t height) {
+    if (format == encoding::format::bits) {
+        apply_bits(settings, parent1, parent2, offspring, width, height);
+        return;
+    }
+
+    const size_t size = parent1.size();
+    const size_t bytes_per_pixel = format == encoding::format::luma ? 1 : 4;
+
+    switch (settings.kind) {
+    case method::single_point: {
+        const size_t point = random_int(0, static_cast<int>(size) - 1);
+        std::copy(parent1.begin(), parent1.begin() + point, offspring.begin());
+        std::copy(parent2.begin() + point, parent2.end(), offspring.begin() + point);
+        return;
+    }
+    case method::two_point: {
+        // A contiguous mask; copying the three runs is the blend without the mask.
+        size_t first = random_int(0, static_cast<int>(size) - 1);
+        size_t second = random_int(0, static_cast<int>(size) - 1);
+        if (first > second)
+            std::swap(first, second);
+        std::copy(parent1.begin(), parent1.begin() + first, offspring.begin());
+        std::copy(parent2.begin() + first, parent2.begin() + second, offspring.begin() + first);
+        std::copy(parent1.begin() + second, parent1.end(), offspring.begin() + second);
+        return;
+    }
+    default:
+        break;
+    }
+
+    const auto mask = mask_buffer(size);
+    switch (settings.kind) {
+    case method::uniform:
+        // blend_bytes only looks at the top bit, so random bytes are a uniform mask.
+        random_bytes(mask.data(), size);
+        break;
+    case method::pixel:
+        if (bytes_per_pixel == 1)
+            random_bytes(mask.data(), size);
+        else
+            build_pixel_mask(mask);
+        break;
+    case method::block: {
+        const size_t block_size = std::max(settings.block_size, 1U);
+        build_block_mask(mask, width * bytes_per_pixel, block_size * bytes_per_pixel, block_size);
+        break;
+    }
+    default:
+        break;
+    }
+
+    kernels::blend_bytes(parent1.data(), parent2.data(), mask.data(), offspring.data(), size);
+}
+
+const char* crossover::method_name(const method value) {
+    switch (value) {
+    case method::single_point: return "single-point";
+    case method::two_point: return "two-point";
+    case method::uniform: return "uniform";
+    case method::pixel: return "pixel";
+    case method::block: return "block";
+    }
+    return "unknown";
+}
+
+bool crossover::parse_method(const char* name, method& value) {
+    for (const method candidate : { method::single_point, method::two_point, method::uniform, method::pixel, method::block }) {
+        if (std::strcmp(name, method_name(candidate)) == 0) {
+            value = candidate;
+            return true;
+        }
+    }
+    return false;
+}
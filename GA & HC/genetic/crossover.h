@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "../utilities/encoding.h"
+
+namespace crossover {
+    enum class method {
+        single_point,
+        two_point,
+        // Every gene (byte, or bit for binary genomes) from either parent.
+        uniform,
+        // Every pixel from either parent; the same as uniform for gray and binary genomes.
+        pixel,
+        // Square tiles of block_size pixels from either parent; keeps
+        // spatially coherent regions together.
+        block
+    };
+
+    struct config {
+        method kind = method::single_point;
+        unsigned int block_size = 8U;
+    };
+
+    // Writes a child of parent1 and parent2 into offspring, genomes of a
+    // width x height image in the given format. Mask based methods build a
+    // selection mask (one bit per pixel for binary genomes) and blend the
+    // parents through it, byte masks with kernels::blend_bytes.
+    void apply(const config& settings, encoding::format format, std::span<const uint8_t> parent1, std::span<const uint8_t> parent2, std::span<uint8_t> offspring, size_t width, size_t height);
+
+    const char* method_name(method value);
+    // Returns false and leaves value untouched for an unknown name.
+    bool parse_method(const char* name, method& value);
+}
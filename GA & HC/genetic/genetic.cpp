@@ -1,299 +1,423 @@
 #include "genetic.h"
-#include <thread>
 #include <algorithm>
+#include <limits>
+#include "../engine/engine.h"
+#include "../engine/modes.h"
+#include "../telemetry/telemetry.h"
+#include "../utilities/cancellation.h"
+#include "../utilities/fnv.h"
+#include "../utilities/instrument.h"
 #include "../utilities/random.h"
 
 
-void genetic_algorithm::mutate_color(individual& ind, const float& mutation_rate) {
-    for (auto& genome : ind.genome) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            genome = random_int(0, 255);
-        }
-    }
-}
-
-void genetic_algorithm::mutate_grayscale(individual& ind, const float& mutation_rate) {
-    for (size_t i = 0; i < ind.genome.size(); i += 4) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            uint8_t gray = random_int(0, 255);
-            ind.genome[i] = gray;
-            ind.genome[i + 1] = gray;
-            ind.genome[i + 2] = gray;
-        }
+void genetic_algorithm::generate_offspring(const population& parents, const selection::selector& selector, const crossover::config& crossover_config, const encoding::format format, std::span<uint8_t> offspring, const globals::target_image& target) {
+    size_t parent1, parent2;
+    {
+        GA_HC_TIME(selection);
+        parent1 = selector.pick();
+        parent2 = selector.pick();
+        for (int attempt = 0; parent2 == parent1 && attempt < 4; ++attempt)
+            parent2 = selector.pick();
     }
-}
 
-void genetic_algorithm::mutate_binary(individual& ind, const float& mutation_rate) {
-    for (size_t i = 0; i < ind.genome.size(); i += 4) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            uint8_t val = (ind.genome[i] == 0) ? 255 : 0;
-            ind.genome[i] = val;
-            ind.genome[i + 1] = val;
-            ind.genome[i + 2] = val;
-        }
-    }
+    GA_HC_TIME(crossover);
+    crossover::apply(crossover_config, format, parents.genome(parent1), parents.genome(parent2), offspring, target.width, target.height);
 }
 
-individual genetic_algorithm::generate_offspring(const std::vector<individual>& population) {
-    individual parent1 = population[0];
-    individual parent2 = population[0];
-
-    for (size_t i = 1; i < static_cast<size_t>(population.size() - random_int(0, random_int(8, 16))); ++i) {
-        if (population[i].fitness > parent1.fitness) {
-            parent1 = population[i];
+// An island's place in its mode's island model. The link of island 0 also
+// carries the mode's best, snapshot and generation, which it keeps up to
+// date from every island's snapshot.
+struct island_link {
+    genetic_algorithm::island_model& model;
+    size_t index;
+    individual* mode_best = nullptr;
+    triple_buffer<individual>* mode_snapshot = nullptr;
+    std::atomic<unsigned int>* mode_generation = nullptr;
+};
+
+static void collect(const island_link& link) {
+    bool improved = false;
+    for (const auto& own : link.model.islands) {
+        if (own->best_snapshot.acquire() && own->best_snapshot.front().fitness > link.mode_best->fitness) {
+            *link.mode_best = own->best_snapshot.front();
+            improved = true;
         }
     }
 
-    for (size_t i = 1; i < static_cast<size_t>(population.size() - random_int(0, random_int(8, 16))); ++i) {
-        if (population[i].fitness > parent2.fitness && population[i].fitness != parent1.fitness) {
-            parent2 = population[i];
-        }
+    if (improved) {
+        link.mode_snapshot->back() = *link.mode_best;
+        link.mode_snapshot->publish();
     }
-
-    parent1.fitness = 0.f;
-    parent2.fitness = 0.f;
-
-    return crossover(parent1, parent2);
+    link.mode_generation->store(link.model.islands.front()->generation.load());
 }
 
-individual genetic_algorithm::crossover(const individual& parent1, const individual& parent2) {
-    individual offspring;
-    offspring.genome.resize(parent1.genome.size());
-    size_t crossover_point = random_int(0, parent1.genome.size() - 1);
-    for (size_t i = 0; i < parent1.genome.size(); ++i) {
-        offspring.genome[i] = (i < crossover_point) ? parent1.genome[i] : parent2.genome[i];
+// Records a scored population. previous_mean carries the mean fitness of the
+// generation before; the first generation has none to beat.
+static void record_population(telemetry::recorder& recorder, const population& pop, const encoding::format format, const unsigned int generation, float& previous_mean) {
+    size_t best = 0, worst = 0, fitter = 0;
+    double sum = 0.0;
+    for (size_t i = 0; i < pop.size(); ++i) {
+        const float fitness = pop.fitness[i];
+        sum += fitness;
+        fitter += fitness > previous_mean;
+        if (fitness > pop.fitness[best])
+            best = i;
+        if (fitness < pop.fitness[worst])
+            worst = i;
     }
-    return offspring;
-}
-
-float genetic_algorithm::calculate_fitness_color(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size();
-    double total_fitness = 0.0;
 
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        int delta = static_cast<int>(ind.genome[i]) - static_cast<int>(globals::image_byte_code_vector[i]);
-        total_fitness += std::abs(delta);
-    }
+    double diversity = 0.0;
+    for (size_t i = 0; i < pop.size(); ++i)
+        diversity += telemetry::distance(format, pop.genome(i), pop.genome(best));
 
-    total_fitness /= bitmap_size;
-    return static_cast<float>(1.0 - (total_fitness / 255.0));
+    const double count = static_cast<double>(pop.size());
+    const float acceptance = previous_mean == std::numeric_limits<float>::infinity() ? telemetry::not_applicable : static_cast<float>(fitter / count);
+    previous_mean = static_cast<float>(sum / count);
+    recorder.record(generation, pop.fitness[best], previous_mean, pop.fitness[worst], acceptance, static_cast<float>(diversity / count), (generation + 1ULL) * pop.size());
 }
 
-float genetic_algorithm::calculate_fitness_gray_scale(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size() / 4;
-    double total_fitness = 0.0;
-
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        const uint8_t r1 = globals::image_byte_code_vector[i * 4 + 0];
-        const uint8_t g1 = globals::image_byte_code_vector[i * 4 + 1];
-        const uint8_t b1 = globals::image_byte_code_vector[i * 4 + 2];
-
-        const uint8_t r2 = ind.genome[i * 4 + 0];
-        const uint8_t g2 = ind.genome[i * 4 + 1];
-        const uint8_t b2 = ind.genome[i * 4 + 2];
-
-        const float gray1 = 0.114f * r1 + 0.587f * g1 + 0.299f * b1;
-        const float gray2 = 0.114f * r2 + 0.587f * g2 + 0.299f * b2;
-
-        const float delta = gray2 - gray1;
-        total_fitness += std::abs(delta);
+// The genetic algorithm as an engine strategy: a step scores the current
+// generation and trades migrants, and preparing the next step breeds the
+// next generation from it.
+template <typename Mode>
+struct genetic_strategy {
+    static constexpr telemetry::algorithm algorithm = telemetry::algorithm::genetic;
+
+    const globals::target_image& target;
+    population& current;
+    population& next;
+    selection::selector& selector;
+    const selection::config& selection_config;
+    const crossover::config& crossover_config;
+    individual& best;
+    triple_buffer<individual>* snapshot;
+    const island_link* link;
+    const std::stop_token& stop;
+    std::atomic<unsigned int>& generation;
+    uint64_t seed;
+    thread_pool& pool;
+    unsigned int parallelism;
+
+    // Whether current's fitness values belong to its genomes.
+    bool scored = false;
+    float previous_mean = std::numeric_limits<float>::infinity();
+
+    unsigned int check_interval() const { return 1U; }
+    unsigned int threads() const { return parallelism; }
+    unsigned int sample_interval() const { return 1U; }
+    unsigned int steps() const { return generation.load(); }
+    float best_fitness() const { return best.fitness; }
+    bool done() const {
+        return link && generation.load() >= link->model.network.stop_generation.load(std::memory_order_relaxed);
     }
 
-    return static_cast<float>(1.0 - (total_fitness / (bitmap_size * 255.0)));
-}
-
-float genetic_algorithm::calculate_fitness_binary(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size() / 4;
-    unsigned int total_fitness = 0U;
-
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        const uint8_t r1 = globals::image_byte_code_vector[i * 4 + 0];
-        const uint8_t g1 = globals::image_byte_code_vector[i * 4 + 1];
-        const uint8_t b1 = globals::image_byte_code_vector[i * 4 + 2];
-
-        const uint8_t r2 = ind.genome[i * 4 + 0];
-        const uint8_t g2 = ind.genome[i * 4 + 1];
-        const uint8_t b2 = ind.genome[i * 4 + 2];
-
-        const float gray1 = 0.114f * r1 + 0.587f * g1 + 0.299f * b1;
-        const float gray2 = 0.114f * r2 + 0.587f * g2 + 0.299f * b2;
-
-        const bool binary1 = gray1 > 128.0f;
-        const bool binary2 = gray2 > 128.0f;
-
-        if (binary1 == binary2)
-            total_fitness++;
+    void evaluate(const bool interruptible) {
+        pool.parallel_for(current.size(), parallelism, [&](const size_t i) {
+            if (!interruptible || !stop.stop_requested()) {
+                GA_HC_TIME(fitness);
+                current.fitness[i] = modes::fitness<Mode>(current.genome(i), target);
+                GA_HC_COUNT(evaluations, 1);
+            }
+        });
     }
 
-    return static_cast<float>(static_cast<float>(total_fitness) / static_cast<float>(bitmap_size));
-}
-
-template <typename FitnessFunc, typename MutateFunc>
-void worker_loop(std::vector<individual>& population, individual& best, std::mutex& mtx, std::atomic<bool>& running, std::atomic<unsigned int>& generation, FitnessFunc fitness_func, MutateFunc mutate_func) {
-    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
-
-    while (running) {
-        for (auto& ind : population) {
-            ind.fitness = fitness_func(ind);
-        }
-
-        individual current_best = population.front();
-        for (const auto& ind : population) {
-            if (ind.fitness > current_best.fitness) {
-                current_best = ind;
+    void publish() {
+        size_t current_best = 0;
+        for (size_t i = 1; i < current.size(); ++i) {
+            if (current.fitness[i] > current.fitness[current_best]) {
+                current_best = i;
             }
         }
 
-        {
-            std::lock_guard<std::mutex> lock(mtx);
-            if (current_best.fitness > best.fitness) {
-                best = current_best;
+        if (current.fitness[current_best] > best.fitness) {
+            GA_HC_COUNT(improvements, 1);
+            {
+                GA_HC_TIME(copy);
+                const auto genome = current.genome(current_best);
+                best.genome.assign(genome.begin(), genome.end());
+            }
+            best.fitness = current.fitness[current_best];
+            if (snapshot) {
+                GA_HC_TIME(publish);
+                snapshot->back() = best;
+                snapshot->publish();
             }
         }
-        std::vector<individual> new_population;
-        new_population.reserve(genetic_algorithm::population_size);
-        new_population.push_back(best);
-        while (new_population.size() < genetic_algorithm::population_size) {
-            individual offspring = genetic_algorithm::generate_offspring(population);
-            mutate_func(offspring, random_float(0.00001f, 0.001f));
-            new_population.push_back(offspring);
-        }
-        population = std::move(new_population);
-        generation++;
-
-        if (generation % genetic_algorithm::interval == 0)
-			std::this_thread::sleep_for(genetic_algorithm::pause_duration);
     }
-}
-
-void genetic_algorithm::color_worker() {
-    worker_loop(color_population, color_best, best_color_mtx, color_running, color_generation, calculate_fitness_color, mutate_color);
-}
 
-void genetic_algorithm::gray_scale_worker() {
-    worker_loop(gray_scale_population, gray_scale_best, best_gray_scale_mtx, gray_scale_running, gray_scale_generation, calculate_fitness_gray_scale, mutate_grayscale);
-}
-
-void genetic_algorithm::binary_worker() {
-    worker_loop(binary_population, binary_best, best_binary_mtx, binary_running, binary_generation, calculate_fitness_binary, mutate_binary);
-}
-
-void genetic_algorithm::initialize() {
-    for (auto& ind : color_population) {
-        ind.genome.resize(genome_size);
-        for (auto& genome : ind.genome) {
-            genome = random_int(0, 255);
+    bool advance() {
+        evaluate(true);
+        if (stop.stop_requested())
+            return false;
+        if (link) {
+            GA_HC_TIME(migration);
+            const island_link& own = *link;
+            if (!own.model.network.exchange(own.index, current, generation, stop, own.model.islands[own.index]->sleeper))
+                return false;
         }
-    }
-    for (auto& ind : gray_scale_population) {
-        ind.genome.resize(genome_size);
-        for (size_t i = 0; i < genome_size; i += 4) {
-            uint8_t gray = random_int(0, 255);
-            ind.genome[i] = gray;
-            ind.genome[i + 1] = gray;
-            ind.genome[i + 2] = gray;
-            ind.genome[i + 3] = 255;
+        publish();
+        scored = true;
+        if (link && link->mode_best) {
+            GA_HC_TIME(publish);
+            collect(*link);
         }
+        return true;
     }
-    for (auto& ind : binary_population) {
-        ind.genome.resize(genome_size);
-        for (size_t i = 0; i < genome_size; i += 4) {
-            uint8_t val = random_int(0, 1) * 255;
-            ind.genome[i] = val;
-            ind.genome[i + 1] = val;
-            ind.genome[i + 2] = val;
-            ind.genome[i + 3] = 255;
+
+    bool prepare() {
+        {
+            GA_HC_TIME(copy);
+            std::copy(best.genome.begin(), best.genome.end(), next.genome(0).begin());
         }
+        {
+            GA_HC_TIME(selection);
+            selector.prepare(current.fitness, selection_config);
+        }
+
+        const size_t pixel_count = target.pixel_count();
+        const uint64_t generation_seed = rng::derive_seed(seed, generation);
+        pool.parallel_for(next.size() - 1, parallelism, [&](const size_t n) {
+            if (stop.stop_requested())
+                return;
+            const size_t i = n + 1;
+            rng::seed_thread(rng::derive_seed(generation_seed, i));
+
+            const auto offspring = next.genome(i);
+            genetic_algorithm::generate_offspring(current, selector, crossover_config, Mode::format, offspring, target);
+            GA_HC_TIME(mutation);
+            Mode::mutate(offspring, random_float(0.00001f, 0.001f), pixel_count, modes::discard{});
+        });
+        // A partly bred generation is dropped; current stays scored.
+        if (stop.stop_requested())
+            return false;
+
+        std::swap(current, next);
+        scored = false;
+        generation++;
+        return true;
     }
 
-    std::thread color_worker_thread(color_worker);
-    std::thread gray_scale_worker_thread(gray_scale_worker);
-    std::thread binary_worker_thread(binary_worker);
+    void sample(telemetry::recorder& recorder) {
+        record_population(recorder, current, Mode::format, generation, previous_mean);
+    }
 
-    MSG msg;
-    while (true) {
-        if (LI_FN(PeekMessageW)(&msg, renderer::overlay::hwnd, 0, 0, PM_REMOVE)) {
-            if (msg.message == WM_QUIT) break;
-            LI_FN(TranslateMessage)(&msg);
-            LI_FN(DispatchMessageW)(&msg);
+    // Stopped between breeding and scoring: score the offspring once more,
+    // uninterrupted, so the stop does not lose them.
+    void finish() {
+        if (!scored) {
+            evaluate(false);
+            publish();
         }
+    }
+};
 
-        {
-            std::lock_guard<std::mutex> lock(best_color_mtx);
-            if (!color_best.genome.empty()) {
-                globals::current_color_bitmap->CopyFromMemory(nullptr, color_best.genome.data(), globals::image_width * 4);
-            }
-        }
+template <typename Mode>
+void worker_loop(const globals::target_image& target, population& current, population& next, selection::selector& selector, const selection::config& selection_config, const crossover::config& crossover_config, individual& best, triple_buffer<individual>* snapshot, const island_link* link, telemetry::log* samples, const std::stop_token& stop, std::atomic<bool>& running, std::atomic<unsigned int>& generation, uint64_t seed, float target_fitness, unsigned int max_generations, thread_pool& pool, unsigned int parallelism) {
+    genetic_strategy<Mode> strategy{ target, current, next, selector, selection_config, crossover_config, best, snapshot, link, stop, generation, seed, pool, parallelism };
+    engine::run(strategy, { target_fitness, max_generations, samples, link ? link->index : 0 }, stop, running);
+}
 
-        {
-            std::lock_guard<std::mutex> lock(best_gray_scale_mtx);
-            if (!gray_scale_best.genome.empty()) {
-                globals::current_gray_scale_bitmap->CopyFromMemory(nullptr, gray_scale_best.genome.data(), globals::image_width * 4);
-            }
+// Runs every island of a mode, island 0 on the calling thread. An island that
+// reaches the target fitness stops the others at the same generation.
+template <typename Mode>
+void island_worker(genetic_algorithm::island_model& model, const selection::config& selection_config, const crossover::config& crossover_config, individual& best, triple_buffer<individual>& snapshot, telemetry::log* samples, const std::stop_token& stop, std::atomic<bool>& running, std::atomic<unsigned int>& generation, uint64_t seed, float target_fitness, unsigned int max_generations, thread_pool& pool, unsigned int parallelism) {
+    const auto run_island = [&](const size_t index) {
+        genetic_algorithm::island& own = *model.islands[index];
+        island_link link{ model, index };
+        if (index == 0) {
+            link.mode_best = &best;
+            link.mode_snapshot = &snapshot;
+            link.mode_generation = &generation;
         }
-
-        {
-            std::lock_guard<std::mutex> lock(best_binary_mtx);
-            if (!binary_best.genome.empty()) {
-                globals::current_binary_bitmap->CopyFromMemory(nullptr, binary_best.genome.data(), globals::image_width * 4);
-            }
+        worker_loop<Mode>(globals::target, own.current, own.next, own.selector, selection_config, crossover_config, own.best, &own.best_snapshot, &link, samples, stop, own.running, own.generation, rng::derive_seed(seed, index), target_fitness, max_generations, pool, parallelism);
+        if (own.best.fitness >= target_fitness) {
+            own.reached_at = own.generation.load();
+            model.network.reached(own.reached_at);
         }
+    };
+
+    std::vector<std::jthread> threads;
+    threads.reserve(model.islands.size() - 1);
+    for (size_t index = 1; index < model.islands.size(); ++index)
+        threads.emplace_back([&run_island, index] { run_island(index); });
+    run_island(0);
+    for (std::jthread& thread : threads)
+        thread.join();
+
+    // The island that reached the target at the lowest generation, the
+    // lowest index among equals, else the fittest; neither choice depends on
+    // when island 0 happened to look.
+    const genetic_algorithm::island* winner = model.islands.front().get();
+    for (const auto& own : model.islands) {
+        const bool earlier = own->reached_at < winner->reached_at;
+        const bool fitter = own->reached_at == UINT_MAX && winner->reached_at == UINT_MAX && own->best.fitness > winner->best.fitness;
+        if (earlier || fitter)
+            winner = own.get();
+    }
+    best = winner->best;
+    snapshot.back() = best;
+    snapshot.publish();
+    generation.store(winner->reached_at != UINT_MAX ? winner->reached_at : model.islands.front()->generation.load());
 
-        renderer::d2d1::render_target->BeginDraw();
-        renderer::d2d1::render_target->Clear();
+    running.store(false);
+    cancellation::worker_finished.notify();
+}
+
+void genetic_algorithm::color_worker(std::stop_token stop) {
+    if (color_islands.islands.size() > 1) {
+        island_worker<modes::color>(color_islands, color_selection, color_crossover, color_best, color_best_snapshot, telemetry::output, stop, color_running, color_generation, rng::derive_seed(seed, color_stream), color_target_fitness, max_generations, *pool, color_parallelism);
+        return;
+    }
+    worker_loop<modes::color>(globals::target, color_population, color_next_population, color_selector, color_selection, color_crossover, color_best, &color_best_snapshot, nullptr, telemetry::output, stop, color_running, color_generation, rng::derive_seed(seed, color_stream), color_target_fitness, max_generations, *pool, color_parallelism);
+}
 
-        auto font = GET_FONT(encrypt("verdana"), 13.f, DWRITE_FONT_WEIGHT_BOLD);
+void genetic_algorithm::gray_scale_worker(std::stop_token stop) {
+    if (gray_scale_islands.islands.size() > 1) {
+        island_worker<modes::gray>(gray_scale_islands, gray_scale_selection, gray_scale_crossover, gray_scale_best, gray_scale_best_snapshot, telemetry::output, stop, gray_scale_running, gray_scale_generation, rng::derive_seed(seed, gray_scale_stream), gray_scale_target_fitness, max_generations, *pool, gray_scale_parallelism);
+        return;
+    }
+    worker_loop<modes::gray>(globals::target, gray_scale_population, gray_scale_next_population, gray_scale_selector, gray_scale_selection, gray_scale_crossover, gray_scale_best, &gray_scale_best_snapshot, nullptr, telemetry::output, stop, gray_scale_running, gray_scale_generation, rng::derive_seed(seed, gray_scale_stream), gray_scale_target_fitness, max_generations, *pool, gray_scale_parallelism);
+}
 
-        vector2 goal_pos(spacing_x, top_y);
-        renderer::items::render_text(font, goal_pos + vector2(0.f, text_offset_y), L"Goal", COLOR_WHITE);
-        renderer::items::render_bitmap(globals::goal_bitmap, goal_pos, goal_pos + bitmap_size, 1.f);
+void genetic_algorithm::binary_worker(std::stop_token stop) {
+    if (binary_islands.islands.size() > 1) {
+        island_worker<modes::binary>(binary_islands, binary_selection, binary_crossover, binary_best, binary_best_snapshot, telemetry::output, stop, binary_running, binary_generation, rng::derive_seed(seed, binary_stream), binary_target_fitness, max_generations, *pool, binary_parallelism);
+        return;
+    }
+    worker_loop<modes::binary>(globals::target, binary_population, binary_next_population, binary_selector, binary_selection, binary_crossover, binary_best, &binary_best_snapshot, nullptr, telemetry::output, stop, binary_running, binary_generation, rng::derive_seed(seed, binary_stream), binary_target_fitness, max_generations, *pool, binary_parallelism);
+}
 
-        if (color_generation.load()) {
-            vector2 color_pos(goal_pos.x + globals::image_width + spacing_x * 5.f, top_y);
-            std::wstring text = L"Color Gen - Fitness: " + std::to_wstring(color_best.fitness) +
-                L" | Gen: " + std::to_wstring(color_generation.load());
-            renderer::items::render_text(font, color_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_color_bitmap, color_pos, vector2(color_pos.x + bitmap_size.x, color_pos.y + bitmap_size.y), 1.f);
-        }
+static void randomize(population& pop, const encoding::format format, const size_t pixel_count) {
+    for (size_t n = 0; n < pop.size(); ++n) {
+        const auto genome = pop.genome(n);
+        random_bytes(genome.data(), genome.size());
+        if (format == encoding::format::bits)
+            encoding::clear_padding(genome.data(), pixel_count);
+    }
+}
 
-        if (gray_scale_generation.load()) {
-            vector2 gray_pos(goal_pos.x + 2 * (globals::image_width + spacing_x * 5.f), top_y);
-            std::wstring text = L"Gray Gen - Fitness: " + std::to_wstring(gray_scale_best.fitness) +
-                L" | Gen: " + std::to_wstring(gray_scale_generation.load());
-            renderer::items::render_text(font, gray_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_gray_scale_bitmap, gray_pos, vector2(gray_pos.x + bitmap_size.x, gray_pos.y + bitmap_size.y), 1.f);
-        }
+static void initialize_islands(genetic_algorithm::island_model& model, const encoding::format format, const size_t genome_size, const uint64_t mode_seed) {
+    model.islands.clear();
+    if (genetic_algorithm::migration_config.islands <= 1)
+        return;
+
+    for (unsigned int index = 0; index < genetic_algorithm::migration_config.islands; ++index) {
+        auto own = std::make_unique<genetic_algorithm::island>();
+        own->current.resize(genetic_algorithm::population_size, genome_size);
+        own->next.resize(genetic_algorithm::population_size, genome_size);
+        randomize(own->current, format, genetic_algorithm::pixel_count);
+        own->best.genome.reserve(genome_size);
+        own->best_snapshot.reset(individual{ std::vector<uint8_t>(genome_size) });
+        model.islands.push_back(std::move(own));
+    }
+    model.network.resize(genetic_algorithm::migration_config, genome_size, rng::derive_seed(mode_seed, ~0ULL));
+}
 
-        if (binary_generation.load()) {
-            vector2 bin_pos(goal_pos.x + 3 * (globals::image_width + spacing_x * 5.f), top_y);
-            std::wstring text = L"Binary Gen - Fitness: " + std::to_wstring(binary_best.fitness) +
-                L" | Gen: " + std::to_wstring(binary_generation.load());
-            renderer::items::render_text(font, bin_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_binary_bitmap, bin_pos, vector2(bin_pos.x + bitmap_size.x, bin_pos.y + bitmap_size.y), 1.f);
-        }
+void genetic_algorithm::initialize() {
+    rng::seed_thread(rng::derive_seed(seed, initialize_stream));
+
+    pixel_count = globals::target.pixel_count();
+    color_genome_size = encoding::genome_size(encoding::format::bgra, pixel_count);
+    gray_scale_genome_size = encoding::genome_size(encoding::format::luma, pixel_count);
+    binary_genome_size = encoding::genome_size(encoding::format::bits, pixel_count);
+
+    color_best = individual{};
+    gray_scale_best = individual{};
+    binary_best = individual{};
+
+    color_generation.store(0);
+    gray_scale_generation.store(0);
+    binary_generation.store(0);
+
+    color_running.store(true);
+    gray_scale_running.store(true);
+    binary_running.store(true);
+
+    // Each island's thread takes part in its own loops, so the pool only
+    // needs the extra threads.
+    const unsigned int islands = std::max(migration_config.islands, 1U);
+    const unsigned int pool_threads = islands * ((std::max(color_parallelism, 1U) - 1U) + (std::max(gray_scale_parallelism, 1U) - 1U) + (std::max(binary_parallelism, 1U) - 1U));
+    if (!pool || pool->size() != pool_threads)
+        pool = std::make_unique<thread_pool>(pool_threads);
+
+    color_population.resize(population_size, color_genome_size);
+    color_next_population.resize(population_size, color_genome_size);
+    gray_scale_population.resize(population_size, gray_scale_genome_size);
+    gray_scale_next_population.resize(population_size, gray_scale_genome_size);
+    binary_population.resize(population_size, binary_genome_size);
+    binary_next_population.resize(population_size, binary_genome_size);
+
+    randomize(color_population, encoding::format::bgra, pixel_count);
+    randomize(gray_scale_population, encoding::format::luma, pixel_count);
+    randomize(binary_population, encoding::format::bits, pixel_count);
+
+    color_best.genome.reserve(color_genome_size);
+    gray_scale_best.genome.reserve(gray_scale_genome_size);
+    binary_best.genome.reserve(binary_genome_size);
+
+    color_best_snapshot.reset(individual{ std::vector<uint8_t>(color_genome_size) });
+    gray_scale_best_snapshot.reset(individual{ std::vector<uint8_t>(gray_scale_genome_size) });
+    binary_best_snapshot.reset(individual{ std::vector<uint8_t>(binary_genome_size) });
+
+    initialize_islands(color_islands, encoding::format::bgra, color_genome_size, rng::derive_seed(seed, color_stream));
+    initialize_islands(gray_scale_islands, encoding::format::luma, gray_scale_genome_size, rng::derive_seed(seed, gray_scale_stream));
+    initialize_islands(binary_islands, encoding::format::bits, binary_genome_size, rng::derive_seed(seed, binary_stream));
+}
 
-        renderer::d2d1::render_target->EndDraw();
+void genetic_algorithm::run(const globals::target_image& target, const run_config& config, run_state& state, std::stop_token stop) {
+    // Single-threaded: a pool without workers runs every loop inline.
+    static thread_pool inline_pool(0U);
+
+    rng::seed_thread(rng::derive_seed(config.seed, initialize_stream));
+
+    const size_t target_pixels = target.pixel_count();
+    const size_t genome_size = encoding::genome_size(config.format, target_pixels);
+    state.current.resize(population_size, genome_size);
+    state.next.resize(population_size, genome_size);
+    randomize(state.current, config.format, target_pixels);
+    state.best = individual{};
+    state.best.genome.reserve(genome_size);
+    state.generation.store(0);
+    state.running.store(true);
+
+    const uint64_t seed = rng::derive_seed(config.seed, config.format == encoding::format::bgra ? color_stream : config.format == encoding::format::luma ? gray_scale_stream : binary_stream);
+    modes::visit(config.format, [&](auto mode) {
+        worker_loop<decltype(mode)>(target, state.current, state.next, state.selector, config.selection, config.crossover, state.best, nullptr, nullptr, nullptr, stop, state.running, state.generation, seed, config.target_fitness, config.max_generations, inline_pool, 1U);
+    });
+}
 
-        if (color_best.fitness >= 0.82)
-            color_running.store(false);
+void genetic_algorithm::start() {
+    color_worker_thread = std::jthread(color_worker);
+    gray_scale_worker_thread = std::jthread(gray_scale_worker);
+    binary_worker_thread = std::jthread(binary_worker);
+}
 
-        if (gray_scale_best.fitness >= 0.98)
-            gray_scale_running.store(false);
+void genetic_algorithm::stop() {
+    // Request every stop before the first join so the workers wind down together.
+    color_worker_thread.request_stop();
+    gray_scale_worker_thread.request_stop();
+    binary_worker_thread.request_stop();
+
+    if (color_worker_thread.joinable())
+        color_worker_thread.join();
+    if (gray_scale_worker_thread.joinable())
+        gray_scale_worker_thread.join();
+    if (binary_worker_thread.joinable())
+        binary_worker_thread.join();
+}
 
-        if (binary_best.fitness >= 1)
-            binary_running.store(false);
+bool genetic_algorithm::update_stop_conditions() {
+    return !color_running && !gray_scale_running && !binary_running;
+}
 
-        if (GetAsyncKeyState(VK_END) & 0x8000 || (!color_running && !gray_scale_running && !binary_running)) {
-            LI_FN(PostQuitMessage)(0);
-            ExitProcess(0);
-            break;
-        }
-    }
+static uint64_t digest_mode(const individual& best, const unsigned int generation, const uint64_t val) {
+    uint64_t result = hash::fnv1a64(best.genome.data(), best.genome.size(), val);
+    result = hash::fnv1a64(&best.fitness, sizeof(best.fitness), result);
+    return hash::fnv1a64(&generation, sizeof(generation), result);
+}
 
-    color_running.store(false);
-    gray_scale_running.store(false);
-    binary_running.store(false);
-    color_worker_thread.join();
-    gray_scale_worker_thread.join();
-    binary_worker_thread.join();
-}
\ No newline at end of file
+uint64_t genetic_algorithm::digest() {
+    uint64_t result = digest_mode(color_best, color_generation.load(), 0xCBF29CE484222325ULL);
+    result = digest_mode(gray_scale_best, gray_scale_generation.load(), result);
+    return digest_mode(binary_best, binary_generation.load(), result);
+}
@@ -1,29 +1,89 @@
 #pragma once
 
 #include <atomic>
-#include <mutex>
+#include <climits>
+#include <memory>
+#include <span>
+#include <stop_token>
+#include <thread>
 #include <vector>
-#include "../globals.h"
+#include "crossover.h"
+#include "migration.h"
+#include "population.h"
+#include "selection.h"
+#include "../target.h"
+#include "../utilities/cancellation.h"
+#include "../utilities/encoding.h"
 #include "../utilities/individual.h"
+#include "../utilities/random.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/triple_buffer.h"
 
 namespace genetic_algorithm {
-    inline constexpr float spacing_x = 75.f;
-    inline constexpr float top_y = 100.f;
-    inline constexpr float text_offset_y = -25.f;
-    inline const vector2 bitmap_size(globals::image_width * 5.f, globals::image_height * 5.f);
-
-	inline const std::chrono::seconds pause_duration(10);
-
-    inline constexpr unsigned int interval = 500U;
     inline constexpr unsigned int population_size = 32U;
-    //inline constexpr unsigned int max_generations = 2000U;
-    inline constexpr unsigned int genome_size = globals::image_width * globals::image_height * 4;
+    // Generations per worker before it stops on its own, 0 = unlimited.
+    inline unsigned int max_generations = 0U;
+    // Sizes of the current target (globals::target), set by initialize().
+    inline size_t pixel_count = 0;
+    inline size_t color_genome_size = 0;
+    inline size_t gray_scale_genome_size = 0;
+    inline size_t binary_genome_size = 0;
     //inline float mutation_rate = 0.001f;
 
-    inline std::vector<individual> color_population(population_size);
-    inline std::vector<individual> gray_scale_population(population_size);
-    inline std::vector<individual> binary_population(population_size);
+    // Threads that evaluate and breed one mode's population, the mode's own
+    // worker thread included. Offspring draw from an engine seeded by
+    // (seed, generation, slot), so every setting produces the same run.
+    inline unsigned int color_parallelism = 1U;
+    inline unsigned int gray_scale_parallelism = 1U;
+    inline unsigned int binary_parallelism = 1U;
+
+    inline selection::config color_selection{};
+    inline selection::config gray_scale_selection{};
+    inline selection::config binary_selection{};
+
+    inline crossover::config color_crossover{};
+    inline crossover::config gray_scale_crossover{ crossover::method::pixel };
+    inline crossover::config binary_crossover{ crossover::method::pixel };
+
+    // Rebuilt from the current population at the start of every breeding step.
+    inline selection::selector color_selector;
+    inline selection::selector gray_scale_selector;
+    inline selection::selector binary_selector;
+
+    // With more than one island each mode evolves that many populations of
+    // population_size on threads of their own, exchanging migrants
+    // (genetic/migration.h). Read by initialize().
+    inline migration::config migration_config{};
+
+    // Shared by all modes; initialize() sizes it for the parallelism above.
+    inline std::unique_ptr<thread_pool> pool;
+
+    inline constexpr float color_target_fitness = 0.82f;
+    inline constexpr float gray_scale_target_fitness = 0.98f;
+    inline constexpr float binary_target_fitness = 1.f;
+
+    // Double-buffered: each generation is bred from *_population into
+    // *_next_population, then the two are swapped.
+    inline population color_population;
+    inline population gray_scale_population;
+    inline population binary_population;
+
+    inline population color_next_population;
+    inline population gray_scale_next_population;
+    inline population binary_next_population;
 
+    // Every worker seeds its thread's engine from this, see rng::derive_seed.
+    inline uint64_t seed = rng::random_seed();
+
+    enum seed_stream : uint64_t {
+        color_stream,
+        gray_scale_stream,
+        binary_stream,
+        initialize_stream
+    };
+
+    // Set while a mode's worker runs; cleared when it finishes on its own
+    // or after a stop request (see cancellation::worker_finished).
     inline std::atomic<bool> color_running{ true };
     inline std::atomic<bool> gray_scale_running{ true };
     inline std::atomic<bool> binary_running{ true };
@@ -32,28 +92,87 @@ namespace genetic_algorithm {
     inline std::atomic<unsigned int> gray_scale_generation{ 0 };
     inline std::atomic<unsigned int> binary_generation{ 0 };
 
-    inline std::mutex best_color_mtx;
-    inline std::mutex best_gray_scale_mtx;
-    inline std::mutex best_binary_mtx;
-
+    // Owned by the mode's worker while it runs; read them after stop().
     inline individual color_best;
     inline individual gray_scale_best;
     inline individual binary_best;
 
+    // Copies of *_best published by the worker whenever it improves; one
+    // other thread (the overlay or the headless reporter) may read each.
+    inline triple_buffer<individual> color_best_snapshot;
+    inline triple_buffer<individual> gray_scale_best_snapshot;
+    inline triple_buffer<individual> binary_best_snapshot;
+
+    // One of a mode's populations under the island model. Its best is
+    // gathered into the mode's *_best by island 0, which runs on the mode's
+    // worker thread.
+    struct island {
+        population current;
+        population next;
+        selection::selector selector;
+        individual best;
+        triple_buffer<individual> best_snapshot;
+        cancellation::sleeper sleeper;
+        // Generation at which its best reached the target fitness, UINT_MAX
+        // if it did not.
+        unsigned int reached_at = UINT_MAX;
+        std::atomic<bool> running{ true };
+        std::atomic<unsigned int> generation{ 0 };
+    };
+
+    struct island_model {
+        // Empty unless migration_config.islands > 1.
+        std::vector<std::unique_ptr<island>> islands;
+        migration::network network;
+    };
+
+    inline island_model color_islands;
+    inline island_model gray_scale_islands;
+    inline island_model binary_islands;
+
+    inline std::jthread color_worker_thread;
+    inline std::jthread gray_scale_worker_thread;
+    inline std::jthread binary_worker_thread;
+
     void initialize();
+    void start();
+    // Asks every worker to stop and joins them. A worker notices within one
+    // genome evaluation or breeding step, then scores its last offspring so
+    // best is up to date.
+    void stop();
+    bool update_stop_conditions();
+    // Hash of every mode's best genome, fitness and generation count; equal
+    // digests after two runs with the same seed and budget mean identical runs.
+    uint64_t digest();
+
+    void color_worker(std::stop_token stop);
+    void gray_scale_worker(std::stop_token stop);
+    void binary_worker(std::stop_token stop);
 
-    void color_worker();
-    void gray_scale_worker();
-    void binary_worker();
+    void generate_offspring(const population& parents, const selection::selector& selector, const crossover::config& crossover_config, encoding::format format, std::span<uint8_t> offspring, const globals::target_image& target);
 
-    void mutate_color(individual& ind, const float& mutation_rate);
-    void mutate_grayscale(individual& ind, const float& mutation_rate);
-    void mutate_binary(individual& ind, const float& mutation_rate);
+    // One mode evolving towards an explicit target with state of its own,
+    // independent of the per-mode globals above (used by the batch runner).
+    struct run_config {
+        encoding::format format = encoding::format::bgra;
+        selection::config selection{};
+        crossover::config crossover{};
+        float target_fitness = 1.f;
+        // 0 = until target_fitness is reached or a stop is requested.
+        unsigned int max_generations = 0U;
+        uint64_t seed = 0;
+    };
 
-    individual generate_offspring(const std::vector<individual>& population);
-    individual crossover(const individual& parent1, const individual& parent2);
+    struct run_state {
+        population current;
+        population next;
+        selection::selector selector;
+        individual best;
+        std::atomic<bool> running{ true };
+        std::atomic<unsigned int> generation{ 0 };
+    };
 
-    float calculate_fitness_color(const individual& ind);
-    float calculate_fitness_gray_scale(const individual& ind);
-    float calculate_fitness_binary(const individual& ind);
+    // Initializes state and evolves on the calling thread until a stop
+    // condition is met or stop is requested.
+    void run(const globals::target_image& target, const run_config& config, run_state& state, std::stop_token stop = {});
 }
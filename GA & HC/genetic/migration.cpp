@@ -0,0 +1,163 @@
+#include "migration.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include "../utilities/instrument.h"
+#include "../utilities/random.h"
+
+void migration::queue::resize(const size_t capacity, const size_t genome_size) {
+    slots.resize(capacity, genome_size);
+    head.store(0);
+    tail.store(0);
+}
+
+bool migration::queue::try_push(std::span<const uint8_t> genome, const float fitness) {
+    const size_t position = tail.load(std::memory_order_relaxed);
+    if (position - head.load(std::memory_order_acquire) == slots.size())
+        return false;
+
+    const size_t slot = position % slots.size();
+    std::copy(genome.begin(), genome.end(), slots.genome(slot).begin());
+    slots.fitness[slot] = fitness;
+    tail.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool migration::queue::try_pop(std::span<uint8_t> genome, float& fitness) {
+    const size_t position = head.load(std::memory_order_relaxed);
+    if (position == tail.load(std::memory_order_acquire))
+        return false;
+
+    const size_t slot = position % slots.size();
+    const auto source = slots.genome(slot);
+    std::copy(source.begin(), source.end(), genome.begin());
+    fitness = slots.fitness[slot];
+    head.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void migration::network::resize(const config& new_settings, const size_t genome_size, const uint64_t new_seed) {
+    settings = new_settings;
+    settings.islands = std::max(settings.islands, 1U);
+    settings.interval = std::max(settings.interval, 1U);
+    settings.migrants = std::clamp(settings.migrants, 1U, max_migrants);
+    seed = new_seed;
+    stop_generation.store(UINT_MAX);
+
+    // Room for two migrations: a sender is at most one epoch ahead of what
+    // its receiver has taken in before it has to wait.
+    const size_t islands = settings.islands;
+    queues.clear();
+    queues.resize(islands * islands);
+    for (size_t from = 0; from < islands; ++from) {
+        for (size_t to = 0; to < islands; ++to) {
+            const bool used = from != to && (settings.kind != topology::ring || to == (from + 1) % islands);
+            if (used) {
+                queues[from * islands + to] = std::make_unique<queue>();
+                queues[from * islands + to]->resize(2 * settings.migrants, genome_size);
+            }
+        }
+    }
+}
+
+bool migration::network::routes(const size_t from, const size_t to, const unsigned int epoch) const {
+    const size_t islands = settings.islands;
+    if (from == to)
+        return false;
+
+    switch (settings.kind) {
+    case topology::ring: return to == (from + 1) % islands;
+    case topology::full: return true;
+    case topology::random: {
+        // Every island can work out every route from the seed alone.
+        const size_t pick = rng::derive_seed(rng::derive_seed(seed, epoch), from) % (islands - 1);
+        return to == (pick < from ? pick : pick + 1);
+    }
+    }
+    return false;
+}
+
+void migration::network::reached(const unsigned int generation) {
+    unsigned int seen = stop_generation.load();
+    while (generation < seen && !stop_generation.compare_exchange_weak(seen, generation)) {}
+}
+
+bool migration::network::exchange(const size_t index, population& pop, const unsigned int generation, const std::stop_token& stop, cancellation::sleeper& sleeper) {
+    if (settings.islands <= 1 || generation == 0 || generation % settings.interval)
+        return true;
+    const unsigned int epoch = generation / settings.interval;
+
+    // Spins briefly, then naps, until ready() or stop. An island past
+    // stop_generation is done and may wait for one that already stopped.
+    const auto wait_for = [&](auto&& ready) {
+        for (unsigned int spins = 0; !ready(); ++spins) {
+            if (stop.stop_requested() || generation > stop_generation.load(std::memory_order_relaxed))
+                return false;
+            if (spins < 64U)
+                std::this_thread::yield();
+            else
+                sleeper.sleep_for(stop, std::chrono::microseconds(100));
+        }
+        return true;
+    };
+
+    // The best `migrants` individuals, best first.
+    std::array<size_t, max_migrants> best{};
+    const size_t count = std::min<size_t>(settings.migrants, pop.size());
+    for (size_t n = 0; n < count; ++n) {
+        size_t candidate = pop.size();
+        for (size_t i = 0; i < pop.size(); ++i) {
+            if (std::find(best.begin(), best.begin() + n, i) != best.begin() + n)
+                continue;
+            if (candidate == pop.size() || pop.fitness[i] > pop.fitness[candidate])
+                candidate = i;
+        }
+        best[n] = candidate;
+    }
+
+    for (size_t to = 0; to < settings.islands; ++to) {
+        if (!routes(index, to, epoch))
+            continue;
+        queue& outbox = route(index, to);
+        for (size_t n = 0; n < count; ++n) {
+            if (!wait_for([&] { return outbox.try_push(pop.genome(best[n]), pop.fitness[best[n]]); }))
+                return false;
+        }
+    }
+
+    if (epoch < 2)
+        return true;
+    for (size_t from = 0; from < settings.islands; ++from) {
+        if (!routes(from, index, epoch - 1))
+            continue;
+        queue& inbox = route(from, index);
+        for (size_t n = 0; n < count; ++n) {
+            const size_t worst = static_cast<size_t>(std::min_element(pop.fitness.begin(), pop.fitness.end()) - pop.fitness.begin());
+            if (!wait_for([&] { return inbox.try_pop(pop.genome(worst), pop.fitness[worst]); }))
+                return false;
+            GA_HC_COUNT(migrants, 1);
+        }
+    }
+    return true;
+}
+
+const char* migration::topology_name(const topology value) {
+    switch (value) {
+    case topology::ring: return "ring";
+    case topology::full: return "full";
+    case topology::random: return "random";
+    }
+    return "unknown";
+}
+
+bool migration::parse_topology(const char* name, topology& value) {
+    for (const topology candidate : { topology::ring, topology::full, topology::random }) {
+        if (std::strcmp(name, topology_name(candidate)) == 0) {
+            value = candidate;
+            return true;
+        }
+    }
+    return false;
+}
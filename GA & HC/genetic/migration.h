@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stop_token>
+#include <vector>
+#include "population.h"
+#include "../utilities/cancellation.h"
+
+// Island model: a mode's population is split into islands that evolve on
+// their own threads and every `interval` generations send copies of their
+// best individuals to other islands, which replace their worst with them.
+namespace migration {
+    enum class topology {
+        // Island i sends to island i + 1.
+        ring,
+        // Every island sends to every other one.
+        full,
+        // Every island sends to one other island, drawn anew each migration.
+        random
+    };
+
+    inline constexpr unsigned int max_migrants = 8U;
+
+    struct config {
+        // 1 = one population, no migration.
+        unsigned int islands = 1U;
+        topology kind = topology::ring;
+        // Generations between migrations.
+        unsigned int interval = 20U;
+        // Best individuals an island sends along each route, at most max_migrants.
+        unsigned int migrants = 2U;
+    };
+
+    // Bounded single-producer single-consumer queue of genomes with their
+    // fitness. The slots are allocated up front; pushing and popping copy a
+    // genome and move one index, without locks.
+    struct queue {
+        void resize(size_t capacity, size_t genome_size);
+
+        bool try_push(std::span<const uint8_t> genome, float fitness);
+        bool try_pop(std::span<uint8_t> genome, float& fitness);
+
+    private:
+        population slots;
+        alignas(64) std::atomic<size_t> head{ 0 };
+        alignas(64) std::atomic<size_t> tail{ 0 };
+    };
+
+    // The routes between the islands of one mode, one queue per ordered pair
+    // of islands that may exchange migrants.
+    //
+    // Migrants sent at migration epoch e are taken in at epoch e + 1, so an
+    // island only waits for another that is a whole interval behind, and
+    // which migrants arrive when never depends on thread timing: runs with
+    // the same seed and generation budget replay exactly.
+    struct network {
+        // Not thread safe; seed drives the random topology.
+        void resize(const config& settings, size_t genome_size, uint64_t seed);
+
+        size_t size() const {
+            return settings.islands;
+        }
+
+        bool routes(size_t from, size_t to, unsigned int epoch) const;
+
+        // Lowest generation at which any island reached the target fitness.
+        // Every island runs until it reaches the target itself or gets this
+        // far; the migrants up to there were all sent by then, so which
+        // island reached it first does not depend on timing.
+        std::atomic<unsigned int> stop_generation{ UINT_MAX };
+
+        // Lowers stop_generation to generation if that is earlier.
+        void reached(unsigned int generation);
+
+        // Called by island `index` on its evaluated population every
+        // generation: on migration generations it sends its best and then
+        // replaces its worst with the migrants of the previous migration.
+        // Returns false if stop was requested, or the island went past
+        // stop_generation, while waiting for a route.
+        bool exchange(size_t index, population& pop, unsigned int generation, const std::stop_token& stop, cancellation::sleeper& sleeper);
+
+    private:
+        queue& route(const size_t from, const size_t to) {
+            return *queues[from * settings.islands + to];
+        }
+
+        config settings;
+        uint64_t seed = 0;
+        // islands x islands, empty where the topology never routes.
+        std::vector<std::unique_ptr<queue>> queues;
+    };
+
+    const char* topology_name(topology value);
+    // Returns false and leaves value untouched for an unknown name.
+    bool parse_topology(const char* name, topology& value);
+}
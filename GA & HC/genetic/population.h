@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../utilities/aligned_allocator.h"
+
+// All genomes of one generation in a single cache-line aligned block; each
+// genome starts on its own cache line (stride rounded up to 64 bytes).
+struct population {
+    static constexpr size_t alignment = 64;
+
+    std::vector<uint8_t, aligned_allocator<uint8_t, alignment>> genomes;
+    std::vector<float> fitness;
+    size_t count = 0;
+    size_t genome_size = 0;
+    size_t stride = 0;
+
+    void resize(const size_t new_count, const size_t new_genome_size) {
+        count = new_count;
+        genome_size = new_genome_size;
+        stride = (new_genome_size + alignment - 1) / alignment * alignment;
+        genomes.assign(count * stride, 0);
+        fitness.assign(count, -1e9f);
+    }
+
+    std::span<uint8_t> genome(const size_t index) {
+        return { genomes.data() + index * stride, genome_size };
+    }
+
+    std::span<const uint8_t> genome(const size_t index) const {
+        return { genomes.data() + index * stride, genome_size };
+    }
+
+    size_t size() const {
+        return count;
+    }
+};
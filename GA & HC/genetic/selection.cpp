@@ -0,0 +1,137 @@
+#include "selection.h"
+#include <algorithm>
+#include <cstring>
+#include "../utilities/random.h"
+
+void selection::selector::prepare(std::span<const float> population_fitness, const config& selection_config) {
+    settings = selection_config;
+    fitness = population_fitness;
+
+    const size_t count = fitness.size();
+    if (settings.kind == method::tournament)
+        return;
+
+    if (settings.kind != method::roulette) {
+        order.resize(count);
+        for (size_t i = 0; i < count; ++i)
+            order[i] = static_cast<uint32_t>(i);
+        std::sort(order.begin(), order.end(), [&](const uint32_t a, const uint32_t b) {
+            return fitness[a] != fitness[b] ? fitness[a] > fitness[b] : a < b;
+        });
+    }
+
+    weights.resize(count);
+    switch (settings.kind) {
+    case method::rank:
+        // Linear ranking: the best of n gets weight n, the worst 1.
+        for (size_t i = 0; i < count; ++i)
+            weights[i] = static_cast<double>(count - i);
+        build_alias_table();
+        break;
+    case method::roulette: {
+        // Fitness may be negative (unevaluated), so weigh by distance to the worst.
+        const float worst = *std::min_element(fitness.begin(), fitness.end());
+        for (size_t i = 0; i < count; ++i)
+            weights[i] = static_cast<double>(fitness[i] - worst) + 1e-6;
+        build_alias_table();
+        break;
+    }
+    case method::truncation:
+        truncation_count = std::clamp<size_t>(static_cast<size_t>(count * settings.truncation_fraction), 1, count);
+        break;
+    default:
+        break;
+    }
+}
+
+void selection::selector::build_alias_table() {
+    const size_t count = weights.size();
+    probability.resize(count);
+    alias.resize(count);
+    small.clear();
+    large.clear();
+    small.reserve(count);
+    large.reserve(count);
+
+    double total = 0.0;
+    for (const double weight : weights)
+        total += weight;
+
+    for (size_t i = 0; i < count; ++i) {
+        weights[i] = weights[i] * count / total;
+        (weights[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+        const uint32_t less = small.back();
+        small.pop_back();
+        const uint32_t more = large.back();
+
+        probability[less] = static_cast<float>(weights[less]);
+        alias[less] = more;
+
+        weights[more] -= 1.0 - weights[less];
+        if (weights[more] < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+
+    // Whatever is left is 1 up to rounding error.
+    for (const uint32_t i : large) {
+        probability[i] = 1.f;
+        alias[i] = i;
+    }
+    for (const uint32_t i : small) {
+        probability[i] = 1.f;
+        alias[i] = i;
+    }
+}
+
+size_t selection::selector::pick_alias() const {
+    const size_t column = rng::bounded(rng::thread_engine(), static_cast<uint32_t>(probability.size()));
+    return random_float(0.f, 1.f) < probability[column] ? column : alias[column];
+}
+
+size_t selection::selector::pick() const {
+    const uint32_t count = static_cast<uint32_t>(fitness.size());
+
+    switch (settings.kind) {
+    case method::tournament: {
+        size_t winner = rng::bounded(rng::thread_engine(), count);
+        for (unsigned int i = 1; i < settings.tournament_size; ++i) {
+            const size_t contestant = rng::bounded(rng::thread_engine(), count);
+            if (fitness[contestant] > fitness[winner])
+                winner = contestant;
+        }
+        return winner;
+    }
+    case method::rank:
+        return order[pick_alias()];
+    case method::roulette:
+        return pick_alias();
+    case method::truncation:
+        return order[rng::bounded(rng::thread_engine(), static_cast<uint32_t>(truncation_count))];
+    }
+    return 0;
+}
+
+const char* selection::method_name(const method value) {
+    switch (value) {
+    case method::tournament: return "tournament";
+    case method::rank: return "rank";
+    case method::roulette: return "roulette";
+    case method::truncation: return "truncation";
+    }
+    return "unknown";
+}
+
+bool selection::parse_method(const char* name, method& value) {
+    for (const method candidate : { method::tournament, method::rank, method::roulette, method::truncation }) {
+        if (std::strcmp(name, method_name(candidate)) == 0) {
+            value = candidate;
+            return true;
+        }
+    }
+    return false;
+}
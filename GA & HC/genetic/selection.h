@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace selection {
+    enum class method {
+        tournament,
+        rank,
+        roulette,
+        truncation
+    };
+
+    struct config {
+        method kind = method::tournament;
+        // Contestants per tournament.
+        unsigned int tournament_size = 4U;
+        // Share of the population, best first, that truncation selection draws from.
+        float truncation_fraction = 0.25f;
+    };
+
+    // Built once per generation from the population's fitness, then queried
+    // for parent indices. pick() only reads the tables and draws from the
+    // calling thread's engine, so it can be used from several threads at once.
+    // The buffers are reused, so preparing a population of the same size
+    // again does not allocate.
+    struct selector {
+        config settings;
+        std::span<const float> fitness;
+
+        // Indices ordered by descending fitness (rank and truncation).
+        std::vector<uint32_t> order;
+
+        // Vose alias table over `order` positions (rank) or indices (roulette).
+        std::vector<float> probability;
+        std::vector<uint32_t> alias;
+        std::vector<double> weights;
+        std::vector<uint32_t> small;
+        std::vector<uint32_t> large;
+
+        size_t truncation_count = 0;
+
+        void prepare(std::span<const float> population_fitness, const config& selection_config);
+        size_t pick() const;
+
+    private:
+        void build_alias_table();
+        size_t pick_alias() const;
+    };
+
+    const char* method_name(method value);
+    // Returns false and leaves value untouched for an unknown name.
+    bool parse_method(const char* name, method& value);
+}
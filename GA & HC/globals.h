@@ -1,897 +1,10 @@
 #pragma once
 #include "renderer/renderer.h"
+#include "target.h"
 
 namespace globals {
 	inline ID2D1Bitmap* goal_bitmap = nullptr;
     inline ID2D1Bitmap* current_color_bitmap = nullptr;
     inline ID2D1Bitmap* current_gray_scale_bitmap = nullptr;
     inline ID2D1Bitmap* current_binary_bitmap = nullptr;
-    
-    inline constexpr unsigned int image_width = 44;
-    inline constexpr unsigned int image_height = 60;
-    inline constexpr uint8_t image_byte_code_array[] = {
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x1D, 0x1B, 0x1A, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF, 0x20, 0x1E, 0x1D, 0xFF,
-        0x1D, 0x1B, 0x1A, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x99, 0x98, 0x98, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF,
-        0xF1, 0xF1, 0xF0, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF,
-        0xF1, 0xF1, 0xF0, 0xFF, 0xF1, 0xF1, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF,
-        0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF,
-        0xF0, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xEF, 0xFF, 0xF0, 0xF0, 0xEF, 0xFF,
-        0xF0, 0xF0, 0xEF, 0xFF, 0xF0, 0xF0, 0xEF, 0xFF, 0xF0, 0xF0, 0xEF, 0xFF,
-        0xF0, 0xEF, 0xEF, 0xFF, 0xF0, 0xEF, 0xEF, 0xFF, 0xF0, 0xEF, 0xEF, 0xFF,
-        0xEF, 0xEF, 0xEE, 0xFF, 0xEF, 0xEF, 0xEE, 0xFF, 0xEF, 0xEF, 0xEE, 0xFF,
-        0xEF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xEF, 0xEE, 0xEE, 0xFF,
-        0xEF, 0xEE, 0xEE, 0xFF, 0xEF, 0xEE, 0xED, 0xFF, 0xEE, 0xEE, 0xED, 0xFF,
-        0xEE, 0xEE, 0xEE, 0xFF, 0xE9, 0xE9, 0xE8, 0xFF, 0xB9, 0xB9, 0xB9, 0xFF,
-        0x33, 0x32, 0x31, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x9E, 0x9D, 0x9D, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF4, 0xF3, 0xF3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xC7, 0xC7, 0xC7, 0xFF,
-        0x33, 0x32, 0x31, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF4, 0xF3, 0xFF,
-        0xE5, 0xE5, 0xE5, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xC6, 0xC6, 0xC6, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF4, 0xF3, 0xFF, 0xE6, 0xE6, 0xE6, 0xFF,
-        0xF2, 0xF2, 0xF2, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF, 0xC5, 0xC5, 0xC5, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x9D, 0x9C, 0x9C, 0xFF, 0xFC, 0xFB, 0xFB, 0xFF, 0xFC, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF4, 0xF4, 0xF3, 0xFF, 0xE6, 0xE6, 0xE6, 0xFF, 0xF2, 0xF2, 0xF2, 0xFF,
-        0xF0, 0xF0, 0xF0, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xC5, 0xC5, 0xC4, 0xFF,
-        0x33, 0x32, 0x31, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF4, 0xF3, 0xFF,
-        0xE5, 0xE5, 0xE5, 0xFF, 0xF1, 0xF1, 0xF1, 0xFF, 0xF0, 0xF0, 0xF0, 0xFF,
-        0xEE, 0xEE, 0xEE, 0xFF, 0xED, 0xED, 0xED, 0xFF, 0xC5, 0xC5, 0xC5, 0xFF,
-        0x33, 0x32, 0x31, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF4, 0xF3, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF,
-        0xF0, 0xF0, 0xF0, 0xFF, 0xEF, 0xEF, 0xEF, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF,
-        0xEC, 0xEC, 0xEC, 0xFF, 0xEB, 0xEB, 0xEB, 0xFF, 0xC1, 0xC0, 0xC0, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x9D, 0x9C, 0x9C, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFB, 0xFF,
-        0xFB, 0xFB, 0xFB, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF4, 0xF4, 0xF3, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0xEF, 0xEF, 0xEF, 0xFF,
-        0xEE, 0xEE, 0xEE, 0xFF, 0xED, 0xED, 0xED, 0xFF, 0xEC, 0xEC, 0xEC, 0xFF,
-        0xEA, 0xEA, 0xEA, 0xFF, 0xE9, 0xE9, 0xE9, 0xFF, 0xBF, 0xBF, 0xBF, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF3, 0xF3, 0xFF,
-        0xE2, 0xE2, 0xE2, 0xFF, 0xEE, 0xEE, 0xEE, 0xFF, 0xED, 0xED, 0xED, 0xFF,
-        0xEC, 0xEC, 0xEC, 0xFF, 0xEB, 0xEB, 0xEB, 0xFF, 0xE9, 0xE9, 0xE9, 0xFF,
-        0xE8, 0xE8, 0xE8, 0xFF, 0xE6, 0xE6, 0xE6, 0xFF, 0xBF, 0xBF, 0xBF, 0xFF,
-        0x33, 0x32, 0x31, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9C, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF3, 0xF2, 0xFF, 0xE1, 0xE1, 0xE1, 0xFF,
-        0xEC, 0xEC, 0xEC, 0xFF, 0xEC, 0xEC, 0xEC, 0xFF, 0xEB, 0xEB, 0xEB, 0xFF,
-        0xEA, 0xEA, 0xEA, 0xFF, 0xE8, 0xE8, 0xE8, 0xFF, 0xE7, 0xE7, 0xE7, 0xFF,
-        0xE6, 0xE6, 0xE6, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF, 0xBE, 0xBE, 0xBE, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x17, 0x15, 0x14, 0xFF,
-        0x9D, 0x9C, 0x9C, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF,
-        0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFB, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF4, 0xF3, 0xF2, 0xFF, 0xE0, 0xE0, 0xE0, 0xFF, 0xEB, 0xEB, 0xEB, 0xFF,
-        0xEA, 0xEA, 0xEA, 0xFF, 0xE9, 0xE9, 0xE9, 0xFF, 0xE8, 0xE8, 0xE8, 0xFF,
-        0xE7, 0xE7, 0xE7, 0xFF, 0xE6, 0xE6, 0xE6, 0xFF, 0xE5, 0xE5, 0xE5, 0xFF,
-        0xE3, 0xE3, 0xE3, 0xFF, 0xE2, 0xE2, 0xE2, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x17, 0x15, 0x14, 0xFF, 0x9D, 0x9C, 0x9B, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF4, 0xF3, 0xF3, 0xFF,
-        0xDE, 0xDE, 0xDE, 0xFF, 0xE9, 0xE9, 0xE9, 0xFF, 0xE9, 0xE9, 0xE9, 0xFF,
-        0xE8, 0xE8, 0xE8, 0xFF, 0xE7, 0xE7, 0xE7, 0xFF, 0xE6, 0xE6, 0xE6, 0xFF,
-        0xE5, 0xE5, 0xE5, 0xFF, 0xE4, 0xE4, 0xE4, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF,
-        0xE1, 0xE1, 0xE1, 0xFF, 0xE1, 0xE1, 0xE1, 0xFF, 0xBC, 0xBC, 0xBC, 0xFF,
-        0x32, 0x31, 0x30, 0xFF, 0x9C, 0x9B, 0x9B, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF5, 0xF4, 0xF4, 0xFF, 0xCB, 0xCB, 0xCB, 0xFF,
-        0xCE, 0xCE, 0xCE, 0xFF, 0xCE, 0xCE, 0xCE, 0xFF, 0xCE, 0xCE, 0xCE, 0xFF,
-        0xCD, 0xCD, 0xCD, 0xFF, 0xCD, 0xCD, 0xCD, 0xFF, 0xCD, 0xCD, 0xCD, 0xFF,
-        0xCC, 0xCC, 0xCC, 0xFF, 0xCC, 0xCC, 0xCC, 0xFF, 0xCB, 0xCB, 0xCB, 0xFF,
-        0xCB, 0xCB, 0xCB, 0xFF, 0xCB, 0xCB, 0xCB, 0xFF, 0x81, 0x80, 0x7E, 0xFF,
-        0x9C, 0x9B, 0x9B, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF6, 0xF5, 0xF5, 0xFF, 0xF3, 0xF2, 0xF1, 0xFF,
-        0xF3, 0xF2, 0xF1, 0xFF, 0xF3, 0xF2, 0xF1, 0xFF, 0xF3, 0xF2, 0xF1, 0xFF,
-        0xF3, 0xF2, 0xF1, 0xFF, 0xF2, 0xF2, 0xF1, 0xFF, 0xF2, 0xF1, 0xF1, 0xFF,
-        0xF2, 0xF1, 0xF1, 0xFF, 0xF2, 0xF1, 0xF0, 0xFF, 0xF2, 0xF1, 0xF0, 0xFF,
-        0xF2, 0xF1, 0xF0, 0xFF, 0x93, 0x91, 0x90, 0xFF, 0x9C, 0x9B, 0x9B, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF,
-        0xFB, 0xFA, 0xFA, 0xFF, 0xFB, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0x95, 0x95, 0x92, 0xFF, 0x9C, 0x9B, 0x9B, 0xFF, 0xFA, 0xFA, 0xFA, 0xFF,
-        0xFA, 0xFA, 0xFA, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0x95, 0x95, 0x92, 0xFF,
-        0x9C, 0x9B, 0x9A, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0x95, 0x93, 0x92, 0xFF, 0x9C, 0x9B, 0x9A, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0x95, 0x93, 0x92, 0xFF, 0x9C, 0x9B, 0x9A, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xF7, 0xF7, 0xF4, 0xFF, 0xE3, 0xDB, 0xC8, 0xFF,
-        0xCE, 0xBF, 0x9C, 0xFF, 0xC1, 0xAE, 0x81, 0xFF, 0xBC, 0xA7, 0x75, 0xFF,
-        0xBD, 0xA8, 0x77, 0xFF, 0xC6, 0xB4, 0x8A, 0xFF, 0xD9, 0xCD, 0xB2, 0xFF,
-        0xF2, 0xEF, 0xE8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0x95, 0x93, 0x92, 0xFF,
-        0x9C, 0x9B, 0x9A, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF, 0xFB, 0xFA, 0xF9, 0xFF,
-        0xFB, 0xFA, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xDC, 0xD3, 0xBB, 0xFF,
-        0xB1, 0x99, 0x5F, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xAA, 0x8F, 0x4F, 0xFF,
-        0xCD, 0xBE, 0x9A, 0xFF, 0xF4, 0xF3, 0xEE, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0x95, 0x93, 0x92, 0xFF, 0x9B, 0x9A, 0x9A, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF4, 0xF2, 0xED, 0xFF,
-        0xBF, 0xAB, 0x7C, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xB2, 0x9A, 0x61, 0xFF, 0xEB, 0xE6, 0xDA, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0x95, 0x93, 0x92, 0xFF, 0x9B, 0x9A, 0x9A, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xF4, 0xF2, 0xED, 0xFF, 0xB6, 0xA0, 0x6A, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xD2, 0xC5, 0xA5, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0x95, 0x93, 0x92, 0xFF,
-        0x9B, 0x9A, 0x9A, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xF9, 0xFA, 0xF9, 0xFF, 0xF9, 0xF9, 0xF7, 0xFF, 0xC0, 0xAC, 0x7D, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xC7, 0xB6, 0x8E, 0xFF, 0xF9, 0xF7, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0x93, 0x93, 0x92, 0xFF, 0x9B, 0x9A, 0x9A, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF, 0xFA, 0xFA, 0xF9, 0xFF,
-        0xFA, 0xFA, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF, 0xF9, 0xFA, 0xF9, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xDE, 0xD4, 0xBD, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xAA, 0x90, 0x50, 0xFF, 0xC8, 0xB7, 0x8E, 0xFF,
-        0xDA, 0xCF, 0xB5, 0xFF, 0xD8, 0xCC, 0xB1, 0xFF, 0xC6, 0xB4, 0x8B, 0xFF,
-        0xAD, 0x93, 0x55, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xC0, 0xAC, 0x7E, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0x93, 0x93, 0x92, 0xFF, 0x9B, 0x9A, 0x9A, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xB4, 0x9C, 0x65, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xB0, 0x97, 0x5D, 0xFF,
-        0xED, 0xE8, 0xDC, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF3, 0xF1, 0xEB, 0xFF,
-        0xCB, 0xBB, 0x97, 0xFF, 0xF6, 0xF4, 0xF2, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0x93, 0x93, 0x92, 0xFF,
-        0x9B, 0x9A, 0x98, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xE7, 0xE0, 0xD1, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA8, 0x8C, 0x4B, 0xFF, 0xE6, 0xDE, 0xCE, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF8, 0xF7, 0xF5, 0xFF, 0xF7, 0xF5, 0xF3, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xEB, 0xE5, 0xD9, 0xFF,
-        0xD1, 0xC3, 0xA2, 0xFF, 0xD1, 0xC3, 0xA2, 0xFF, 0xF5, 0xF5, 0xF2, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0x93, 0x93, 0x92, 0xFF, 0x9B, 0x9A, 0x98, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF,
-        0xFA, 0xF9, 0xF9, 0xFF, 0xFA, 0xF9, 0xF9, 0xFF, 0xF9, 0xF9, 0xF9, 0xFF,
-        0xF9, 0xF9, 0xF9, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xCF, 0xC0, 0x9E, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xBD, 0xA8, 0x78, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xCD, 0xBD, 0x99, 0xFF,
-        0xAD, 0x93, 0x56, 0xFF, 0xD6, 0xC9, 0xAD, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xDC, 0xD1, 0xBA, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xF3, 0xF1, 0xEC, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0x93, 0x93, 0x92, 0xFF, 0x9B, 0x98, 0x98, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xBD, 0xA9, 0x79, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xDA, 0xCE, 0xB5, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xC9, 0xB8, 0x91, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xD3, 0xC5, 0xA6, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xDC, 0xD1, 0xBA, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xF3, 0xF0, 0xEC, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF7, 0xF6, 0xFF, 0x93, 0x93, 0x92, 0xFF,
-        0x99, 0x98, 0x98, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xB1, 0x98, 0x5E, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x4A, 0xFF,
-        0xEC, 0xE7, 0xDC, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xD6, 0xCA, 0xAD, 0xFF, 0xD3, 0xC5, 0xA6, 0xFF,
-        0xB9, 0xA3, 0x6F, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xBE, 0xAA, 0x7A, 0xFF,
-        0xD3, 0xC5, 0xA5, 0xFF, 0xDB, 0xD0, 0xB7, 0xFF, 0xF5, 0xF3, 0xEF, 0xFF,
-        0xC6, 0xB5, 0x8C, 0xFF, 0xC6, 0xB5, 0x8C, 0xFF, 0xBB, 0xA6, 0x74, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xC4, 0xB2, 0x88, 0xFF,
-        0xC6, 0xB4, 0x8C, 0xFF, 0xCC, 0xBC, 0x97, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0x93, 0x93, 0x90, 0xFF, 0x9B, 0x98, 0x98, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF,
-        0xFA, 0xF9, 0xF8, 0xFF, 0xFA, 0xF9, 0xF8, 0xFF, 0xAC, 0x91, 0x53, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA8, 0x8D, 0x4C, 0xFF, 0xF1, 0xEF, 0xE7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF8, 0xF6, 0xF5, 0xFF,
-        0xAF, 0x95, 0x59, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xB9, 0xA3, 0x6F, 0xFF, 0xF3, 0xEF, 0xE9, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xB0, 0x97, 0x5C, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x93, 0x93, 0x90, 0xFF, 0x99, 0x98, 0x98, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xAD, 0x93, 0x55, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA8, 0x8D, 0x4B, 0xFF, 0xF1, 0xED, 0xE6, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xCE, 0xBE, 0x9B, 0xFF,
-        0xC9, 0xB9, 0x92, 0xFF, 0xB5, 0x9E, 0x67, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xB9, 0xA3, 0x70, 0xFF, 0xC9, 0xB9, 0x92, 0xFF, 0xD4, 0xC7, 0xA8, 0xFF,
-        0xF4, 0xF1, 0xEC, 0xFF, 0xB3, 0x9C, 0x64, 0xFF, 0xB3, 0x9C, 0x64, 0xFF,
-        0xAF, 0x96, 0x5A, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xB3, 0x9B, 0x62, 0xFF, 0xB3, 0x9C, 0x64, 0xFF, 0xBB, 0xA6, 0x74, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x93, 0x90, 0xFF,
-        0x99, 0x98, 0x98, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xB5, 0x9E, 0x67, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x4A, 0xFF,
-        0xEB, 0xE5, 0xDA, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xC9, 0xB8, 0x91, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xD3, 0xC5, 0xA6, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xDB, 0xD1, 0xBA, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xF3, 0xF0, 0xEB, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x93, 0x90, 0xFF, 0x99, 0x98, 0x98, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF,
-        0xF9, 0xF9, 0xF8, 0xFF, 0xF9, 0xF9, 0xF8, 0xFF, 0xC4, 0xB2, 0x88, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xD9, 0xCE, 0xB4, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xC9, 0xB8, 0x91, 0xFF,
-        0xA7, 0x8B, 0x4A, 0xFF, 0xD3, 0xC6, 0xA6, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xDB, 0xD1, 0xB9, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xF3, 0xF0, 0xEB, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x93, 0x93, 0x90, 0xFF, 0x99, 0x98, 0x98, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xDA, 0xCE, 0xB5, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xBB, 0xA6, 0x74, 0xFF, 0xF9, 0xF7, 0xF6, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF2, 0xEE, 0xE7, 0xFF, 0xEC, 0xE7, 0xDC, 0xFF,
-        0xF3, 0xF0, 0xEB, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xDF, 0xD5, 0xC0, 0xFF, 0xB0, 0x96, 0x5C, 0xFF, 0xB0, 0x96, 0x5C, 0xFF,
-        0xF3, 0xF1, 0xEC, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x93, 0x90, 0xFF,
-        0x99, 0x98, 0x98, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF3, 0xF1, 0xEC, 0xFF, 0xAB, 0x91, 0x52, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x4A, 0xFF, 0xD6, 0xC9, 0xAC, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xEF, 0xED, 0xE5, 0xFF,
-        0xF5, 0xF4, 0xF2, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x91, 0x90, 0xFF, 0x99, 0x98, 0x98, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF8, 0xFF,
-        0xF9, 0xF8, 0xF8, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xCB, 0xBA, 0x94, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA8, 0x8C, 0x4B, 0xFF, 0xD2, 0xC5, 0xA5, 0xFF, 0xF6, 0xF5, 0xF2, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xE8, 0xE2, 0xD4, 0xFF, 0xB1, 0x98, 0x5E, 0xFF, 0xC3, 0xB0, 0x85, 0xFF,
-        0xF8, 0xF6, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x93, 0x91, 0x90, 0xFF, 0x99, 0x98, 0x96, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xED, 0xE9, 0xDF, 0xFF,
-        0xA8, 0x8D, 0x4C, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xAD, 0x93, 0x55, 0xFF, 0xBF, 0xAC, 0x7D, 0xFF,
-        0xC3, 0xB0, 0x85, 0xFF, 0xB7, 0xA0, 0x6B, 0xFF, 0xA7, 0x8C, 0x4A, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xCC, 0xBD, 0x99, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x91, 0x90, 0xFF,
-        0x99, 0x98, 0x96, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xCA, 0xBA, 0x94, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xD6, 0xCA, 0xAE, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x93, 0x91, 0x90, 0xFF, 0x99, 0x98, 0x96, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF5, 0xF3, 0xEF, 0xFF, 0xB9, 0xA3, 0x6F, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xBC, 0xA7, 0x76, 0xFF, 0xF7, 0xF6, 0xF4, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x90, 0xFF, 0x99, 0x98, 0x96, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF4, 0xF2, 0xED, 0xFF, 0xC0, 0xAD, 0x7F, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xC0, 0xAD, 0x7F, 0xFF,
-        0xF5, 0xF2, 0xEF, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF,
-        0x99, 0x98, 0x96, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF, 0xF9, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xE1, 0xD8, 0xC4, 0xFF,
-        0xBB, 0xA6, 0x74, 0xFF, 0xA9, 0x8E, 0x4E, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x49, 0xFF,
-        0xA7, 0x8B, 0x49, 0xFF, 0xA7, 0x8B, 0x4A, 0xFF, 0xB3, 0x9B, 0x63, 0xFF,
-        0xDB, 0xD0, 0xB8, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF, 0x99, 0x98, 0x96, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF, 0xF8, 0xF8, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF2, 0xF0, 0xEA, 0xFF, 0xE2, 0xDA, 0xC7, 0xFF, 0xD4, 0xC7, 0xA8, 0xFF,
-        0xCD, 0xBE, 0x9B, 0xFF, 0xCD, 0xBE, 0x9B, 0xFF, 0xD6, 0xC9, 0xAD, 0xFF,
-        0xE8, 0xE2, 0xD4, 0xFF, 0xF7, 0xF6, 0xF4, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x90, 0xFF, 0x99, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF,
-        0x99, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF7, 0xFF,
-        0xF8, 0xF7, 0xF7, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF, 0x97, 0x96, 0x96, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xE6, 0xD2, 0xAD, 0xFF,
-        0xD0, 0x94, 0x22, 0xFF, 0xF5, 0xCF, 0x7E, 0xFF, 0xF6, 0xEC, 0xD8, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x90, 0xFF, 0x97, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xE0, 0xC6, 0x96, 0xFF, 0xBC, 0x7D, 0x05, 0xFF, 0xC5, 0x82, 0x09, 0xFF,
-        0xF3, 0xB1, 0x26, 0xFF, 0xF3, 0xB3, 0x2A, 0xFF, 0xF5, 0xD8, 0x9C, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF,
-        0x97, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF6, 0xF4, 0xEF, 0xFF,
-        0xF3, 0xEA, 0xD7, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF4, 0xFF, 0xDB, 0xBC, 0x85, 0xFF, 0xBA, 0x7A, 0x02, 0xFF,
-        0xB9, 0x78, 0x00, 0xFF, 0xC4, 0x80, 0x09, 0xFF, 0xF3, 0xAF, 0x25, 0xFF,
-        0xF3, 0xAF, 0x25, 0xFF, 0xF4, 0xC9, 0x71, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x90, 0xFF, 0x97, 0x96, 0x96, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xE1, 0xB3, 0x55, 0xFF, 0xD6, 0x92, 0x08, 0xFF,
-        0xE9, 0xCD, 0x95, 0xFF, 0xF6, 0xF5, 0xF3, 0xFF, 0xD5, 0xB2, 0x74, 0xFF,
-        0xB8, 0x76, 0x00, 0xFF, 0xB8, 0x76, 0x00, 0xFF, 0xBB, 0x7D, 0x0E, 0xFF,
-        0xE1, 0xBA, 0x75, 0xFF, 0xF3, 0xAD, 0x24, 0xFF, 0xF3, 0xAD, 0x24, 0xFF,
-        0xF4, 0xC8, 0x71, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x8E, 0xFF, 0x97, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xEB, 0xD1, 0x9E, 0xFF, 0xD5, 0x8F, 0x05, 0xFF, 0xD4, 0x8C, 0x00, 0xFF,
-        0xD2, 0x96, 0x27, 0xFF, 0xB4, 0x70, 0x00, 0xFF, 0xB5, 0x73, 0x00, 0xFF,
-        0xC3, 0x8E, 0x31, 0xFF, 0xEE, 0xE4, 0xD3, 0xFF, 0xF6, 0xE4, 0xC3, 0xFF,
-        0xF2, 0xAB, 0x24, 0xFF, 0xF2, 0xAB, 0x24, 0xFF, 0xF4, 0xC6, 0x70, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x8E, 0xFF,
-        0x97, 0x96, 0x96, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xEA, 0xD2, 0xA6, 0xFF, 0xD1, 0x89, 0x01, 0xFF, 0xD2, 0x89, 0x00, 0xFF,
-        0xCD, 0x84, 0x00, 0xFF, 0xCC, 0x9B, 0x4B, 0xFF, 0xF5, 0xF2, 0xEE, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF6, 0xE4, 0xC3, 0xFF, 0xF2, 0xA9, 0x23, 0xFF,
-        0xF2, 0xA9, 0x23, 0xFF, 0xF4, 0xC5, 0x70, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x8E, 0xFF, 0x97, 0x96, 0x96, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF, 0xF8, 0xF7, 0xF6, 0xFF,
-        0xF7, 0xF7, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF2, 0xED, 0xE4, 0xFF, 0xC1, 0x8D, 0x39, 0xFF,
-        0xB5, 0x6F, 0x00, 0xFF, 0xCF, 0x84, 0x00, 0xFF, 0xD1, 0x87, 0x00, 0xFF,
-        0xD3, 0x8C, 0x0B, 0xFF, 0xE9, 0xCD, 0x9C, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF6, 0xE3, 0xC3, 0xFF, 0xF2, 0xA7, 0x22, 0xFF, 0xF2, 0xA7, 0x22, 0xFF,
-        0xF3, 0xC4, 0x6F, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x8E, 0xFF, 0x97, 0x96, 0x96, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF6, 0xFF,
-        0xF7, 0xF6, 0xF6, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xC4, 0x93, 0x44, 0xFF, 0xB0, 0x6D, 0x00, 0xFF, 0xBC, 0x84, 0x2A, 0xFF,
-        0xE5, 0xCD, 0xA7, 0xFF, 0xD5, 0x91, 0x1C, 0xFF, 0xD0, 0x84, 0x00, 0xFF,
-        0xD0, 0x84, 0x00, 0xFF, 0xDF, 0xB0, 0x60, 0xFF, 0xF4, 0xDE, 0xB9, 0xFF,
-        0xF1, 0xA4, 0x22, 0xFF, 0xF1, 0xA4, 0x22, 0xFF, 0xF3, 0xC2, 0x6F, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x8E, 0xFF,
-        0x97, 0x96, 0x95, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xE6, 0xD6, 0xBC, 0xFF,
-        0xCE, 0xA9, 0x6B, 0xFF, 0xF4, 0xF0, 0xEB, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF2, 0xE8, 0xD8, 0xFF, 0xD5, 0x93, 0x25, 0xFF, 0xCF, 0x82, 0x00, 0xFF,
-        0xCF, 0x81, 0x00, 0xFF, 0xD8, 0x8D, 0x1B, 0xFF, 0xF1, 0xA2, 0x21, 0xFF,
-        0xF1, 0xA2, 0x21, 0xFF, 0xF3, 0xC1, 0x6F, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x8E, 0xFF, 0x97, 0x96, 0x95, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF4, 0xEE, 0xE4, 0xFF, 0xD6, 0x97, 0x32, 0xFF, 0xCE, 0x7F, 0x00, 0xFF,
-        0xD4, 0x80, 0x08, 0xFF, 0xF1, 0xA0, 0x20, 0xFF, 0xF1, 0xA0, 0x20, 0xFF,
-        0xF3, 0xC1, 0x72, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x91, 0x8E, 0xFF, 0x97, 0x96, 0x95, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF5, 0xF1, 0xEB, 0xFF, 0xD8, 0x9E, 0x44, 0xFF, 0xD3, 0x7F, 0x08, 0xFF,
-        0xF0, 0xA1, 0x27, 0xFF, 0xF3, 0xC3, 0x79, 0xFF, 0xF6, 0xEE, 0xE1, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x91, 0x8E, 0xFF,
-        0x97, 0x96, 0x95, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF6, 0xF3, 0xF0, 0xFF, 0xEC, 0xCA, 0x9A, 0xFF, 0xF6, 0xEC, 0xDE, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0x91, 0x8F, 0x8E, 0xFF, 0x97, 0x96, 0x95, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF, 0xF7, 0xF6, 0xF5, 0xFF,
-        0x91, 0x8F, 0x8E, 0xFF, 0x8E, 0x8D, 0x8D, 0xFF, 0xE6, 0xE6, 0xE5, 0xFF,
-        0xE6, 0xE6, 0xE5, 0xFF, 0xE6, 0xE6, 0xE5, 0xFF, 0xE6, 0xE6, 0xE5, 0xFF,
-        0xE6, 0xE6, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF,
-        0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF,
-        0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF,
-        0xE6, 0xE5, 0xE4, 0xFF, 0xE6, 0xE5, 0xE4, 0xFF, 0xE5, 0xE5, 0xE4, 0xFF,
-        0xE5, 0xE5, 0xE4, 0xFF, 0xE5, 0xE5, 0xE4, 0xFF, 0xE5, 0xE5, 0xE4, 0xFF,
-        0xE5, 0xE5, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF,
-        0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF,
-        0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF,
-        0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF, 0xE5, 0xE4, 0xE3, 0xFF,
-        0xE4, 0xE4, 0xE3, 0xFF, 0xE4, 0xE4, 0xE2, 0xFF, 0xE4, 0xE4, 0xE2, 0xFF,
-        0xE4, 0xE3, 0xE2, 0xFF, 0xE4, 0xE3, 0xE2, 0xFF, 0xE4, 0xE3, 0xE2, 0xFF,
-        0xE4, 0xE3, 0xE2, 0xFF, 0xE4, 0xE3, 0xE2, 0xFF, 0xE4, 0xE3, 0xE2, 0xFF,
-        0xE4, 0xE3, 0xE2, 0xFF, 0xE4, 0xE3, 0xE2, 0xFF, 0x88, 0x87, 0x85, 0xFF
-
-    };
-
-    inline std::vector <uint8_t> image_byte_code_vector(image_byte_code_array, image_byte_code_array + (image_width * image_height * 4));
-}
\ No newline at end of file
+}
@@ -0,0 +1,584 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include "batch/batch.h"
+#include "batch/convergence.h"
+#include "genetic/genetic.h"
+#include "hill_climbing/hill_climbing.h"
+#include "image/image_loader.h"
+#include "kernels/fitness_kernels.h"
+#include "telemetry/telemetry.h"
+#include "utilities/cancellation.h"
+#include "utilities/instrument.h"
+#include "utilities/random.h"
+#include "utilities/throttle.h"
+
+// Requested on SIGINT/SIGTERM (Ctrl+C on Windows): runs stop early but
+// still report, and batches write what they have.
+static std::stop_source interrupt;
+
+struct headless_options {
+    std::string target_path;
+    std::string batch_manifest;
+    std::string convergence_manifest;
+    unsigned int convergence_runs = 10U;
+    // Empty and 0 pick the defaults of --batch or --convergence.
+    std::string batch_output;
+    unsigned int batch_threads = 0U;
+    bool run_genetic = true;
+    bool run_hill_climbing = true;
+    double max_seconds = 0.0;
+    double report_interval = 1.0;
+    uint64_t seed = rng::random_seed();
+    unsigned int max_generations = 0U;
+    unsigned int max_iterations = 0U;
+    unsigned int genetic_threads = 1U;
+    selection::method genetic_selection = selection::method::tournament;
+    bool override_crossover = false;
+    crossover::method genetic_crossover = crossover::method::single_point;
+    migration::config genetic_migration{};
+    hill_climbing::multi_start_config climbing{};
+    float cpu_budget = 1.f;
+    platform::priority priority = platform::priority::normal;
+    bool verify_replay = false;
+    bool check_digest = false;
+    uint64_t expected_digest = 0;
+    std::string stats_path;
+    std::string telemetry_path;
+    std::string telemetry_csv;
+    bool show_help = false;
+};
+
+static void print_usage(const char* program) {
+    std::printf(
+        "usage: %s [options]\n"
+        "  --target <file>            target image (PNG, BMP, PPM or PGM; default: built-in 44x60 image)\n"
+        "  --algorithm <ga|hc|both>   algorithms to run (default: both)\n"
+        "  --max-seconds <seconds>    wall clock budget, 0 = until targets are reached (default: 0)\n"
+        "  --report-interval <sec>    seconds between progress lines (default: 1)\n"
+        "  --isa <scalar|sse2|avx2>   cap the SIMD kernels (default: best supported)\n"
+        "  --seed <n>                 run seed; the same seed and budget replay the same run (default: random)\n"
+        "  --max-generations <n>      stop each genetic algorithm worker after n generations\n"
+        "  --max-iterations <n>       stop each hill climbing worker after n iterations\n"
+        "  --ga-threads <n>           threads per genetic algorithm mode; results do not depend on it (default: 1)\n"
+        "  --selection <method>       tournament|rank|roulette|truncation parent selection (default: tournament)\n"
+        "  --crossover <method>       single-point|two-point|uniform|pixel|block for every mode\n"
+        "                             (default: single-point for color, pixel for gray and binary)\n"
+        "  --islands <n>              genetic algorithm populations per mode, each on its own thread (default: 1)\n"
+        "  --topology <kind>          ring|full|random migration routes between islands (default: ring)\n"
+        "  --migration-interval <n>   generations between migrations (default: 20)\n"
+        "  --migrants <n>             best individuals sent along each route, 1-8 (default: 2)\n"
+        "  --climbers <n>             hill climbers per mode, each on its own thread (default: 1)\n"
+        "  --restart <strategy>       random|perturb-best|iterated restart of stuck climbers when --climbers > 1\n"
+        "                             (default: random)\n"
+        "  --perturbation <fraction>  share of genes a perturbing restart randomizes, 0-1 (default: 0.02)\n"
+        "  --cpu-budget <fraction>    share of a core each worker thread may use, 0.05-1 (default: 1, unthrottled)\n"
+        "  --priority <level>         idle|low|normal|high scheduling priority of the workers (default: normal)\n"
+        "  --verify-replay            run twice with the same seed and check both runs are identical\n"
+        "  --expect-digest <hex>      fail unless the run's digest is this one, to catch drift between commits\n"
+        "  --stats <file>             write phase timings and counters as JSON at every report and at the end\n"
+        "                             (needs a build configured with -DGA_HC_INSTRUMENT=ON)\n"
+        "  --telemetry <file>         log a convergence sample every generation and every --telemetry-interval\n"
+        "                             iterations to a binary file\n"
+        "  --telemetry-interval <n>   hill climbing iterations between telemetry samples (default: 1000)\n"
+        "  --telemetry-csv <file>     print a telemetry log as CSV and exit\n"
+        "  --batch <manifest>         run every job of a manifest instead; the options above are job defaults\n"
+        "  --convergence <manifest>   run every manifest line --runs times and report time to its target fitness\n"
+        "  --runs <n>                 runs per manifest line with --convergence, each with its own seed (default: 10)\n"
+        "  --batch-threads <n>        jobs run at the same time (default: hardware threads, 1 with --convergence)\n"
+        "  --output <dir>             where batch results go (default: batch-results or convergence-results)\n"
+        "  --help                     show this message\n", program);
+}
+
+static bool parse_options(int argc, char** argv, headless_options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+
+        if (arg == "--target" && has_value) {
+            options.target_path = argv[++i];
+        }
+        else if (arg == "--algorithm" && has_value) {
+            const std::string value = argv[++i];
+            options.run_genetic = value == "ga" || value == "both";
+            options.run_hill_climbing = value == "hc" || value == "both";
+            if (!options.run_genetic && !options.run_hill_climbing) {
+                std::fprintf(stderr, "unknown algorithm '%s'\n", value.c_str());
+                return false;
+            }
+        }
+        else if (arg == "--max-seconds" && has_value) {
+            options.max_seconds = std::atof(argv[++i]);
+        }
+        else if (arg == "--report-interval" && has_value) {
+            options.report_interval = std::atof(argv[++i]);
+        }
+        else if (arg == "--isa" && has_value) {
+            const std::string value = argv[++i];
+            if (value == "scalar")
+                kernels::select_isa(kernels::isa::scalar);
+            else if (value == "sse2")
+                kernels::select_isa(kernels::isa::sse2);
+            else if (value == "avx2")
+                kernels::select_isa(kernels::isa::avx2);
+            else {
+                std::fprintf(stderr, "unknown isa '%s'\n", value.c_str());
+                return false;
+            }
+        }
+        else if (arg == "--seed" && has_value) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--max-generations" && has_value) {
+            options.max_generations = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--max-iterations" && has_value) {
+            options.max_iterations = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--ga-threads" && has_value) {
+            options.genetic_threads = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--selection" && has_value) {
+            if (!selection::parse_method(argv[++i], options.genetic_selection)) {
+                std::fprintf(stderr, "unknown selection method '%s'\n", argv[i]);
+                return false;
+            }
+        }
+        else if (arg == "--crossover" && has_value) {
+            if (!crossover::parse_method(argv[++i], options.genetic_crossover)) {
+                std::fprintf(stderr, "unknown crossover method '%s'\n", argv[i]);
+                return false;
+            }
+            options.override_crossover = true;
+        }
+        else if (arg == "--islands" && has_value) {
+            options.genetic_migration.islands = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--topology" && has_value) {
+            if (!migration::parse_topology(argv[++i], options.genetic_migration.kind)) {
+                std::fprintf(stderr, "unknown topology '%s'\n", argv[i]);
+                return false;
+            }
+        }
+        else if (arg == "--migration-interval" && has_value) {
+            options.genetic_migration.interval = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--migrants" && has_value) {
+            options.genetic_migration.migrants = std::clamp(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)), 1U, migration::max_migrants);
+        }
+        else if (arg == "--climbers" && has_value) {
+            options.climbing.climbers = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--restart" && has_value) {
+            if (!hill_climbing::parse_restart(argv[++i], options.climbing.restart)) {
+                std::fprintf(stderr, "unknown restart strategy '%s'\n", argv[i]);
+                return false;
+            }
+        }
+        else if (arg == "--perturbation" && has_value) {
+            options.climbing.perturbation = static_cast<float>(std::atof(argv[++i]));
+            if (!(options.climbing.perturbation > 0.f && options.climbing.perturbation <= 1.f)) {
+                std::fprintf(stderr, "--perturbation must be in (0, 1]\n");
+                return false;
+            }
+        }
+        else if (arg == "--batch" && has_value) {
+            options.batch_manifest = argv[++i];
+        }
+        else if (arg == "--convergence" && has_value) {
+            options.convergence_manifest = argv[++i];
+        }
+        else if (arg == "--runs" && has_value) {
+            options.convergence_runs = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--batch-threads" && has_value) {
+            options.batch_threads = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--output" && has_value) {
+            options.batch_output = argv[++i];
+        }
+        else if (arg == "--cpu-budget" && has_value) {
+            options.cpu_budget = static_cast<float>(std::atof(argv[++i]));
+            if (!(options.cpu_budget > 0.f && options.cpu_budget <= 1.f)) {
+                std::fprintf(stderr, "--cpu-budget must be in (0, 1]\n");
+                return false;
+            }
+        }
+        else if (arg == "--priority" && has_value) {
+            if (!platform::parse_priority(argv[++i], options.priority)) {
+                std::fprintf(stderr, "unknown priority '%s'\n", argv[i]);
+                return false;
+            }
+        }
+        else if (arg == "--verify-replay") {
+            options.verify_replay = true;
+        }
+        else if (arg == "--expect-digest" && has_value) {
+            options.expected_digest = std::strtoull(argv[++i], nullptr, 16);
+            options.check_digest = true;
+        }
+        else if (arg == "--telemetry" && has_value) {
+            options.telemetry_path = argv[++i];
+        }
+        else if (arg == "--telemetry-interval" && has_value) {
+            telemetry::iteration_interval = std::max(1U, static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (arg == "--telemetry-csv" && has_value) {
+            options.telemetry_csv = argv[++i];
+        }
+        else if (arg == "--stats" && has_value) {
+            options.stats_path = argv[++i];
+            if (!instrument::enabled) {
+                std::fprintf(stderr, "--stats needs a build configured with -DGA_HC_INSTRUMENT=ON\n");
+                return false;
+            }
+        }
+        else if (arg == "--help") {
+            options.show_help = true;
+        }
+        else {
+            std::fprintf(stderr, "unknown or incomplete option '%s'\n", arg.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads the fitness of the worker's latest published best; the main thread
+// is the only reader of each snapshot.
+static void report(const char* algorithm, const char* mode, triple_buffer<individual>& best, unsigned int generation) {
+    best.acquire();
+    std::printf("[%s] %-6s fitness: %f | gen: %u\n", algorithm, mode, best.front().fitness, generation);
+}
+
+static void report_progress(const headless_options& options) {
+    if (options.run_genetic) {
+        using namespace genetic_algorithm;
+        report("ga", "color", color_best_snapshot, color_generation.load());
+        report("ga", "gray", gray_scale_best_snapshot, gray_scale_generation.load());
+        report("ga", "binary", binary_best_snapshot, binary_generation.load());
+    }
+    if (options.run_hill_climbing) {
+        using namespace hill_climbing;
+        report("hc", "color", color_best_snapshot, color_generation.load());
+        report("hc", "gray", gray_scale_best_snapshot, gray_scale_generation.load());
+        report("hc", "binary", binary_best_snapshot, binary_generation.load());
+    }
+    std::fflush(stdout);
+}
+
+// Replaces the stats file through a temporary one, so readers polling it
+// never see half a report.
+static void write_stats(const headless_options& options) {
+    if (options.stats_path.empty())
+        return;
+
+    const std::string temporary = options.stats_path + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "w");
+    if (!file) {
+        std::fprintf(stderr, "cannot write '%s'\n", temporary.c_str());
+        return;
+    }
+    instrument::write_json(file, instrument::collect());
+    std::fclose(file);
+
+    std::error_code error;
+    std::filesystem::rename(temporary, options.stats_path, error);
+    if (error)
+        std::fprintf(stderr, "cannot write '%s': %s\n", options.stats_path.c_str(), error.message().c_str());
+}
+
+static void report_stats(const headless_options& options) {
+    if (!instrument::enabled)
+        return;
+    instrument::write_text(stdout, instrument::collect());
+    write_stats(options);
+}
+
+static uint64_t run(const headless_options& options) {
+    genetic_algorithm::seed = rng::derive_seed(options.seed, 1);
+    genetic_algorithm::max_generations = options.max_generations;
+    genetic_algorithm::color_parallelism = options.genetic_threads;
+    genetic_algorithm::gray_scale_parallelism = options.genetic_threads;
+    genetic_algorithm::binary_parallelism = options.genetic_threads;
+    genetic_algorithm::color_selection.kind = options.genetic_selection;
+    genetic_algorithm::gray_scale_selection.kind = options.genetic_selection;
+    genetic_algorithm::binary_selection.kind = options.genetic_selection;
+    if (options.override_crossover) {
+        genetic_algorithm::color_crossover.kind = options.genetic_crossover;
+        genetic_algorithm::gray_scale_crossover.kind = options.genetic_crossover;
+        genetic_algorithm::binary_crossover.kind = options.genetic_crossover;
+    }
+    genetic_algorithm::migration_config = options.genetic_migration;
+    hill_climbing::seed = rng::derive_seed(options.seed, 2);
+    hill_climbing::max_iterations = options.max_iterations;
+    hill_climbing::multi_start = options.climbing;
+
+    instrument::reset();
+    if (options.run_genetic) {
+        genetic_algorithm::initialize();
+        genetic_algorithm::start();
+    }
+    if (options.run_hill_climbing) {
+        hill_climbing::initialize();
+        hill_climbing::start();
+    }
+
+    const auto finished = [&options] {
+        return (!options.run_genetic || genetic_algorithm::update_stop_conditions()) &&
+            (!options.run_hill_climbing || hill_climbing::update_stop_conditions());
+    };
+    // An interrupt wakes the wait below like a finishing worker does.
+    const std::stop_callback wake_on_interrupt(interrupt.get_token(), [] { cancellation::worker_finished.notify(); });
+
+    using clock = std::chrono::steady_clock;
+    const auto start_time = clock::now();
+    const auto report_interval = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(std::max(options.report_interval, 0.01)));
+    const auto deadline = start_time + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(options.max_seconds));
+    auto next_report = start_time + report_interval;
+
+    while (true) {
+        const auto wake = options.max_seconds > 0.0 ? std::min(next_report, deadline) : next_report;
+        if (cancellation::worker_finished.wait_until(wake, [&] { return finished() || interrupt.stop_requested(); }))
+            break;
+
+        const auto now = clock::now();
+        if (options.max_seconds > 0.0 && now >= deadline)
+            break;
+        if (now >= next_report) {
+            report_progress(options);
+            write_stats(options);
+            next_report = now + report_interval;
+        }
+    }
+
+    const bool stopped_early = !finished();
+    const auto stop_time = clock::now();
+    if (options.run_genetic)
+        genetic_algorithm::stop();
+    if (options.run_hill_climbing)
+        hill_climbing::stop();
+    if (stopped_early) {
+        std::printf("%s, workers stopped in %.2f ms\n", interrupt.stop_requested() ? "interrupted" : "time limit reached",
+            std::chrono::duration<double, std::milli>(clock::now() - stop_time).count());
+    }
+
+    report_progress(options);
+
+    uint64_t digest = 0;
+    if (options.run_genetic)
+        digest ^= genetic_algorithm::digest();
+    if (options.run_hill_climbing)
+        digest ^= rng::derive_seed(hill_climbing::digest(), 0);
+    return digest;
+}
+
+static void report_throttle() {
+    if (throttle::utilization.load() < 1.f || throttle::throttled_nanoseconds.load()) {
+        std::printf("throttle: %.0f%% cpu budget per worker, %s priority, %.2fs throttled\n",
+            throttle::utilization.load() * 100.0, platform::priority_name(throttle::priority.load()), throttle::throttled_seconds());
+    }
+    if (throttle::priority_refused.load())
+        std::printf("throttle: %s priority refused for some workers, they kept their previous level\n", platform::priority_name(throttle::priority.load()));
+}
+
+static void report_job(const batch::job& work, const batch::job_result& result) {
+    if (!result.ok) {
+        std::printf("[job] %s: %s: %s\n", work.name.c_str(), batch::status_name(result), result.error.c_str());
+    }
+    else {
+        std::printf("[job] %s: %s %s %ux%u fitness: %f | gen: %u | %.2fs%s\n", work.name.c_str(), batch::algorithm_name(work.kind), batch::format_name(work.format),
+            result.width, result.height, result.fitness, result.generations, result.seconds, result.reached_target ? " | target reached" : result.stopped ? " | stopped" : "");
+    }
+    std::fflush(stdout);
+}
+
+static batch::job job_defaults(const headless_options& options) {
+    batch::job defaults;
+    defaults.seed = options.seed;
+    defaults.max_generations = options.max_generations;
+    defaults.max_iterations = options.max_iterations;
+    defaults.max_seconds = options.max_seconds;
+    defaults.selection = options.genetic_selection;
+    defaults.override_crossover = options.override_crossover;
+    defaults.crossover = options.genetic_crossover;
+    return defaults;
+}
+
+static int run_batch(const headless_options& options) {
+    std::vector<batch::job> jobs;
+    std::string error;
+    if (!batch::parse_manifest(options.batch_manifest.c_str(), job_defaults(options), jobs, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("fitness kernels: %s\n", kernels::isa_name(kernels::active_isa()));
+    std::printf("batch: %zu jobs on %u threads -> %s\n", jobs.size(), options.batch_threads, options.batch_output.c_str());
+    std::printf("seed: %" PRIu64 "\n", options.seed);
+    std::fflush(stdout);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    std::vector<batch::job_result> results;
+    if (!batch::run(jobs, options.batch_threads, options.batch_output, results, report_job, interrupt.get_token(), error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    size_t failed = 0, reached = 0, stopped = 0;
+    double busy = 0.0;
+    for (const auto& result : results) {
+        failed += !result.ok && !result.stopped;
+        reached += result.ok && result.reached_target;
+        stopped += result.stopped;
+        busy += result.seconds;
+    }
+    std::printf("batch: %zu ok, %zu failed, %zu stopped, %zu reached target | %.2fs wall, %.2f jobs/s, %.0f%% of %u threads busy\n",
+        results.size() - failed - stopped, failed, stopped, reached, elapsed, elapsed > 0.0 ? results.size() / elapsed : 0.0,
+        elapsed > 0.0 ? 100.0 * busy / (elapsed * options.batch_threads) : 0.0, options.batch_threads);
+    report_throttle();
+    report_stats(options);
+    return failed || interrupt.stop_requested() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static int run_convergence(const headless_options& options) {
+    std::vector<batch::job> configs;
+    std::string error;
+    if (!batch::parse_manifest(options.convergence_manifest.c_str(), job_defaults(options), configs, error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("fitness kernels: %s\n", kernels::isa_name(kernels::active_isa()));
+    std::printf("convergence: %zu configs x %u runs on %u threads -> %s\n", configs.size(), options.convergence_runs, options.batch_threads, options.batch_output.c_str());
+    std::printf("seed: %" PRIu64 "\n", options.seed);
+    std::fflush(stdout);
+
+    std::vector<convergence::summary> summaries;
+    if (!convergence::run(configs, options.convergence_runs, options.batch_threads, options.batch_output, summaries, report_job, interrupt.get_token(), error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%-32s %7s %12s %12s %14s %14s %9s\n", "config", "reached", "median s", "p90 s", "median evals", "p90 evals", "fitness");
+    for (const convergence::summary& row : summaries) {
+        std::printf("%-32s %3u/%-3u %12.3f %12.3f %14.0f %14.0f %9.6f\n", row.config.name.c_str(), row.reached, row.runs - row.failed,
+            row.median_seconds, row.p90_seconds, row.median_evaluations, row.p90_evaluations, row.median_fitness);
+    }
+    report_throttle();
+    report_stats(options);
+    return interrupt.stop_requested() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+    headless_options options;
+    if (!parse_options(argc, argv, options) || options.show_help) {
+        print_usage(argv[0]);
+        return options.show_help ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (!options.telemetry_csv.empty()) {
+        std::string error;
+        if (!telemetry::convert_to_csv(options.telemetry_csv.c_str(), stdout, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    platform::stop_on_interrupt(interrupt);
+
+    throttle::set_utilization(options.cpu_budget);
+    throttle::priority.store(options.priority);
+    if (!platform::set_process_priority(options.priority))
+        std::fprintf(stderr, "cannot set %s priority without privileges, keeping the current one\n", platform::priority_name(options.priority));
+
+    const bool converging = !options.convergence_manifest.empty();
+    if (!options.telemetry_path.empty() && (converging || !options.batch_manifest.empty())) {
+        std::fprintf(stderr, "--telemetry records single runs, not --batch or --convergence\n");
+        return EXIT_FAILURE;
+    }
+    if (options.batch_output.empty())
+        options.batch_output = converging ? "convergence-results" : "batch-results";
+    if (!options.batch_threads)
+        options.batch_threads = converging ? 1U : std::max(1U, std::thread::hardware_concurrency());
+
+    if (converging)
+        return run_convergence(options);
+    if (!options.batch_manifest.empty())
+        return run_batch(options);
+
+    if (options.verify_replay && (options.max_seconds > 0.0 ||
+        (options.run_genetic && !options.max_generations) || (options.run_hill_climbing && !options.max_iterations))) {
+        std::fprintf(stderr, "--verify-replay needs --max-generations/--max-iterations for the selected algorithms and no --max-seconds\n");
+        return EXIT_FAILURE;
+    }
+    if (options.verify_replay && !options.telemetry_path.empty()) {
+        std::fprintf(stderr, "--telemetry cannot be combined with --verify-replay, which would log both runs into one file\n");
+        return EXIT_FAILURE;
+    }
+    if (options.verify_replay && options.run_hill_climbing && options.climbing.climbers > 1 && options.climbing.restart == hill_climbing::restart_strategy::perturb_best) {
+        std::fprintf(stderr, "--verify-replay cannot replay --restart perturb-best, which depends on timing\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!options.target_path.empty()) {
+        image::bitmap loaded;
+        std::string error;
+        if (!image::load(options.target_path.c_str(), loaded, error)) {
+            std::fprintf(stderr, "failed to load target: %s\n", error.c_str());
+            return EXIT_FAILURE;
+        }
+        globals::target = globals::make_target(loaded.width, loaded.height, loaded.bgra.data());
+    }
+
+    std::printf("fitness kernels: %s\n", kernels::isa_name(kernels::active_isa()));
+    std::printf("target: %ux%u%s%s\n", globals::target.width, globals::target.height,
+        options.target_path.empty() ? " (built-in)" : " ", options.target_path.c_str());
+    std::printf("seed: %" PRIu64 "\n", options.seed);
+
+    telemetry::log samples;
+    if (!options.telemetry_path.empty()) {
+        std::string error;
+        if (!samples.open(options.telemetry_path, error)) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return EXIT_FAILURE;
+        }
+        telemetry::output = &samples;
+    }
+
+    const uint64_t digest = run(options);
+    std::printf("digest: %016" PRIx64 "\n", digest);
+    report_throttle();
+    report_stats(options);
+
+    if (options.check_digest && digest != options.expected_digest && !interrupt.stop_requested()) {
+        std::printf("digest: MISMATCH, expected %016" PRIx64 "\n", options.expected_digest);
+        return EXIT_FAILURE;
+    }
+
+    if (options.verify_replay && !interrupt.stop_requested()) {
+        const uint64_t replay_digest = run(options);
+        std::printf("replay digest: %016" PRIx64 "\n", replay_digest);
+        if (replay_digest != digest) {
+            std::printf("replay: MISMATCH\n");
+            return EXIT_FAILURE;
+        }
+        std::printf("replay: identical\n");
+    }
+
+    if (telemetry::output) {
+        telemetry::output = nullptr;
+        samples.close();
+        std::printf("telemetry: %" PRIu64 " samples, %" PRIu64 " dropped -> %s\n", samples.written_samples(), samples.dropped_samples(), options.telemetry_path.c_str());
+    }
+
+    return interrupt.stop_requested() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,281 +1,460 @@
-#include <thread>
 #include "hill_climbing.h"
-#include "../utilities/random.h"
 #include <algorithm>
+#include <cstring>
+#include "../engine/engine.h"
+#include "../engine/modes.h"
+#include "../telemetry/telemetry.h"
+#include "../utilities/cancellation.h"
+#include "../utilities/fnv.h"
+#include "../utilities/instrument.h"
+#include "../utilities/random.h"
 
-void hill_climbing::mutate_color(individual& ind, const float& mutation_rate) {
-    for (auto& genome : ind.genome) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            genome = random_int(0, 255);
-        }
-    }
-}
-
-void hill_climbing::mutate_grayscale(individual& ind, const float& mutation_rate) {
-    for (size_t i = 0; i < ind.genome.size(); i += 4) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            uint8_t gray = random_int(0, 255);
-            ind.genome[i] = gray;
-            ind.genome[i + 1] = gray;
-            ind.genome[i + 2] = gray;
-        }
+template <typename Mode>
+static bool step(individual& current, mutation_log& log, const globals::target_image& target) {
+    {
+        GA_HC_TIME(mutation);
+        log.clear();
+        Mode::mutate(current.genome, random_float(0.00001f, 0.001f), target.pixel_count(), modes::record{ log });
     }
-}
 
-void hill_climbing::mutate_binary(individual& ind, const float& mutation_rate) {
-    for (size_t i = 0; i < ind.genome.size(); i += 4) {
-        if (random_float(0.f, 1.f) < mutation_rate) {
-            uint8_t val = (ind.genome[i] == 0) ? 255 : 0;
-            ind.genome[i] = val;
-            ind.genome[i + 1] = val;
-            ind.genome[i + 2] = val;
-        }
+    uint64_t neighbor_error;
+    float neighbor_fitness;
+    {
+        GA_HC_TIME(fitness);
+        neighbor_error = Mode::update_error(current.error, current.genome.data(), log, target);
+        neighbor_fitness = Mode::fitness(neighbor_error, target);
+        GA_HC_COUNT(evaluations, 1);
     }
-}
-
-float hill_climbing::calculate_fitness_color(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size();
-    double total_fitness = 0.0;
 
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        int delta = static_cast<int>(ind.genome[i]) - static_cast<int>(globals::image_byte_code_vector[i]);
-        total_fitness += std::abs(delta);
+    if (neighbor_fitness > current.fitness) {
+        current.error = neighbor_error;
+        current.fitness = neighbor_fitness;
+        return true;
     }
 
-    total_fitness /= bitmap_size;
-    return static_cast<float>(1.0 - (total_fitness / 255.0));
+    GA_HC_TIME(undo);
+    Mode::undo(current.genome.data(), log);
+    return false;
 }
 
-float hill_climbing::calculate_fitness_gray_scale(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size() / 4;
-    double total_fitness = 0.0;
-
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        const uint8_t r1 = globals::image_byte_code_vector[i * 4 + 0];
-        const uint8_t g1 = globals::image_byte_code_vector[i * 4 + 1];
-        const uint8_t b1 = globals::image_byte_code_vector[i * 4 + 2];
-
-        const uint8_t r2 = ind.genome[i * 4 + 0];
-        const uint8_t g2 = ind.genome[i * 4 + 1];
-        const uint8_t b2 = ind.genome[i * 4 + 2];
-
-        const float gray1 = 0.114f * r1 + 0.587f * g1 + 0.299f * b1;
-        const float gray2 = 0.114f * r2 + 0.587f * g2 + 0.299f * b2;
+bool hill_climbing::step_color(individual& current, mutation_log& log, const globals::target_image& target) {
+    return step<modes::color>(current, log, target);
+}
 
-        const float delta = gray2 - gray1;
-        total_fitness += std::abs(delta);
-    }
+bool hill_climbing::step_gray_scale(individual& current, mutation_log& log, const globals::target_image& target) {
+    return step<modes::gray>(current, log, target);
+}
 
-    return static_cast<float>(1.0 - (total_fitness / (bitmap_size * 255.0)));
+bool hill_climbing::step_binary(individual& current, mutation_log& log, const globals::target_image& target) {
+    return step<modes::binary>(current, log, target);
 }
 
-float hill_climbing::calculate_fitness_binary(const individual& ind) {
-    const size_t bitmap_size = globals::image_byte_code_vector.size() / 4;
-    unsigned int total_fitness = 0U;
+// Scores current from scratch.
+static void rescore(individual& current, const encoding::format format, const globals::target_image& target) {
+    modes::visit(format, [&](auto mode) {
+        using Mode = decltype(mode);
+        current.error = Mode::error(current.genome.data(), target);
+        current.fitness = Mode::fitness(current.error, target);
+    });
+}
 
-    for (size_t i = 0; i < bitmap_size; ++i) {
-        const uint8_t r1 = globals::image_byte_code_vector[i * 4 + 0];
-        const uint8_t g1 = globals::image_byte_code_vector[i * 4 + 1];
-        const uint8_t b1 = globals::image_byte_code_vector[i * 4 + 2];
+static void randomize_genome(individual& current, const encoding::format format, const globals::target_image& target) {
+    const size_t pixel_count = target.pixel_count();
+    const size_t genome_size = encoding::genome_size(format, pixel_count);
 
-        const uint8_t r2 = ind.genome[i * 4 + 0];
-        const uint8_t g2 = ind.genome[i * 4 + 1];
-        const uint8_t b2 = ind.genome[i * 4 + 2];
+    current.genome.resize(genome_size);
+    random_bytes(current.genome.data(), genome_size);
+    if (format == encoding::format::bits)
+        encoding::clear_padding(current.genome.data(), pixel_count);
 
-        const float gray1 = 0.114f * r1 + 0.587f * g1 + 0.299f * b1;
-        const float gray2 = 0.114f * r2 + 0.587f * g2 + 0.299f * b2;
+    rescore(current, format, target);
+}
 
-        const bool binary1 = gray1 > 128.0f;
-        const bool binary2 = gray2 > 128.0f;
+// Randomizes about `share` of current's genes and rescores it.
+template <typename Mode>
+static void perturb(individual& current, const float share, const globals::target_image& target) {
+    Mode::mutate(current.genome, share, target.pixel_count(), modes::discard{});
+    rescore(current, Mode::format, target);
+}
 
-        if (binary1 == binary2)
-            total_fitness++;
+// A climber's place in its mode's climber pool. The link of climber 0 also
+// carries the mode's best, snapshot and iteration count, which it keeps up
+// to date from the pool's global best.
+struct climber_link {
+    hill_climbing::climber_pool& pool;
+    hill_climbing::multi_start_config settings;
+    size_t index;
+    individual* mode_best = nullptr;
+    triple_buffer<individual>* mode_snapshot = nullptr;
+    std::atomic<unsigned int>* mode_generation = nullptr;
+};
+
+static void collect(const climber_link& link) {
+    if (link.pool.global_best.error() < link.mode_best->error && link.pool.global_best.read(*link.mode_best)) {
+        link.mode_snapshot->back() = *link.mode_best;
+        link.mode_snapshot->publish();
     }
+    link.mode_generation->store(link.pool.climbers.front()->generation.load());
+}
 
-    return static_cast<float>(static_cast<float>(total_fitness) / static_cast<float>(bitmap_size));
+template <typename Mode>
+static void restart(const climber_link& link, individual& current, const individual& best, const globals::target_image& target) {
+    switch (link.settings.restart) {
+    case hill_climbing::restart_strategy::random:
+        randomize_genome(current, Mode::format, target);
+        return;
+    case hill_climbing::restart_strategy::perturb_best:
+        if (!link.pool.global_best.read(current))
+            current = best;
+        break;
+    case hill_climbing::restart_strategy::iterated:
+        current = best;
+        break;
+    }
+    perturb<Mode>(current, link.settings.perturbation, target);
 }
 
-template <typename FitnessFunc, typename MutateFunc, typename InitFunc>
-void worker_loop(individual& current, individual& best, std::mutex& mtx, unsigned int& failure_count,std::atomic<bool>& running, std::atomic<unsigned int>& iteration, FitnessFunc fitness_func, MutateFunc mutate_func, InitFunc init_func) {
-    
-    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+// Hill climbing as an engine strategy: a step tries one neighbour, and
+// preparing the next step restarts a stuck climber and publishes its best
+// now and then.
+template <typename Mode>
+struct climbing_strategy {
+    static constexpr telemetry::algorithm algorithm = telemetry::algorithm::hill_climbing;
+
+    const globals::target_image& target;
+    individual& current;
+    individual& best;
+    triple_buffer<individual>* snapshot;
+    const climber_link* link;
+    unsigned int& failure_count;
+    std::atomic<unsigned int>& iteration;
+
+    mutation_log log{};
+    // current is fitter than best, whose genome is only brought up to date
+    // when it is needed: once per publish, restart or exit, not per step.
+    bool improved = false;
+    // Improvements accepted since best was last published, counted in steps.
+    bool unpublished = false;
+    unsigned int since_publish = 0;
+    // Accepted steps since the last telemetry sample.
+    unsigned int accepted = 0;
+    unsigned int last_sample = 0;
+
+    unsigned int check_interval() const { return hill_climbing::throttle_check_interval; }
+    unsigned int threads() const { return 1U; }
+    unsigned int sample_interval() const { return telemetry::iteration_interval; }
+    unsigned int steps() const { return iteration.load(); }
+    float best_fitness() const { return improved ? current.fitness : best.fitness; }
+
+    bool done() const {
+        return link && iteration >= link->pool.stop_iteration.load(std::memory_order_relaxed);
+    }
 
-    reset : 
-    init_func();
+    void update_best() {
+        if (improved) {
+            GA_HC_TIME(copy);
+            best = current;
+            improved = false;
+        }
+    }
 
-    while (running) {
-        individual neighbor = current;
-        mutate_func(neighbor, random_float(0.00001f, 0.001f));
-        float neighbor_fitness = fitness_func(neighbor);
+    void publish() {
+        update_best();
+        GA_HC_TIME(publish);
+        if (snapshot) {
+            snapshot->back() = best;
+            snapshot->publish();
+        }
+        if (link)
+            link->pool.global_best.offer(best);
+        unpublished = false;
+        since_publish = 0;
+    }
 
-        if (neighbor_fitness > current.fitness) {
-            current = neighbor;
-            current.fitness = neighbor_fitness;
+    void reset() {
+        hill_climbing::randomize(current, best, Mode::format, target);
+        publish();
+    }
 
-            {
-                std::lock_guard<std::mutex> lock(mtx);
-                if (current.fitness > best.fitness) {
-                    best = current;
-                }
+    bool advance() {
+        if (step<Mode>(current, log, target)) {
+            accepted++;
+            if (current.fitness > best.fitness) {
+                GA_HC_COUNT(improvements, 1);
+                improved = true;
+                unpublished = true;
             }
         }
-        else 
+        else
             failure_count++;
 
+        iteration++;
+        return true;
+    }
+
+    bool prepare() {
         if (failure_count >= hill_climbing::failure_threshold)
         {
             failure_count = 0;
-            goto reset;
+            update_best();
+            {
+                GA_HC_TIME(restart);
+                GA_HC_COUNT(restarts, 1);
+                if (link)
+                    restart<Mode>(*link, current, best, target);
+                else
+                    hill_climbing::randomize(current, best, Mode::format, target);
+            }
+            if (!link)
+                publish();
         }
 
-        iteration++;
+        if (unpublished && ++since_publish >= hill_climbing::publish_interval)
+            publish();
+
+        if (link && link->mode_best && iteration % hill_climbing::publish_interval == 0) {
+            GA_HC_TIME(publish);
+            collect(*link);
+        }
+        return true;
+    }
+
+    void sample(telemetry::recorder& recorder) {
+        const unsigned int steps = iteration - last_sample;
+        recorder.record(iteration, best_fitness(), telemetry::not_applicable, telemetry::not_applicable, steps ? static_cast<float>(accepted) / static_cast<float>(steps) : 0.f,
+            improved ? 0.f : telemetry::distance(Mode::format, current.genome, best.genome), iteration);
+        accepted = 0;
+        last_sample = iteration;
+    }
+
+    void finish() {
+        if (unpublished)
+            publish();
+    }
+};
+
+template <typename Mode>
+void worker_loop(const globals::target_image& target, individual& current, individual& best, triple_buffer<individual>* snapshot, const climber_link* link, telemetry::log* samples, unsigned int& failure_count, const std::stop_token& stop, std::atomic<bool>& running, std::atomic<unsigned int>& iteration, uint64_t seed, float target_fitness, unsigned int max_iterations, size_t log_capacity) {
+    rng::seed_thread(seed);
+
+    climbing_strategy<Mode> strategy{ target, current, best, snapshot, link, failure_count, iteration };
+    strategy.log.reserve(log_capacity);
+    strategy.reset();
+    strategy.last_sample = iteration;
+
+    engine::run(strategy, { target_fitness, max_iterations, samples, link ? link->index : 0 }, stop, running);
+}
 
-        if (iteration % hill_climbing::interval == 0)
-            std::this_thread::sleep_for(hill_climbing::pause_duration);
+// Runs every climber of a mode, climber 0 on the calling thread. A climber
+// that reaches the target fitness stops the others once they get to the
+// iteration it reached it at.
+template <typename Mode>
+void climbers_worker(hill_climbing::climber_pool& pool, individual& best, triple_buffer<individual>& snapshot, telemetry::log* samples, const std::stop_token& stop, std::atomic<bool>& running, std::atomic<unsigned int>& generation, uint64_t seed, float target_fitness, unsigned int max_iterations, size_t log_capacity) {
+    const auto run_climber = [&](const size_t index) {
+        hill_climbing::climber& own = *pool.climbers[index];
+        climber_link link{ pool, hill_climbing::multi_start, index };
+        if (index == 0) {
+            link.mode_best = &best;
+            link.mode_snapshot = &snapshot;
+            link.mode_generation = &generation;
+        }
+        worker_loop<Mode>(globals::target, own.current, own.best, nullptr, &link, samples, own.failure_count, stop, own.running, own.generation, rng::derive_seed(seed, index), target_fitness, max_iterations, log_capacity);
+        if (own.best.fitness >= target_fitness) {
+            own.reached_at = own.generation.load();
+            unsigned int seen = pool.stop_iteration.load();
+            while (own.reached_at < seen && !pool.stop_iteration.compare_exchange_weak(seen, own.reached_at)) {}
+        }
+    };
+
+    std::vector<std::jthread> threads;
+    threads.reserve(pool.climbers.size() - 1);
+    for (size_t index = 1; index < pool.climbers.size(); ++index)
+        threads.emplace_back([&run_climber, index] { run_climber(index); });
+    run_climber(0);
+    for (std::jthread& thread : threads)
+        thread.join();
+
+    // The climber that reached the target at the lowest iteration, the lower
+    // index on a tie, or the fittest when none did; the climbers' own bests
+    // rather than the global best, which may have missed a last offer when
+    // every buffer was busy. Neither choice depends on timing.
+    const hill_climbing::climber* winner = pool.climbers.front().get();
+    for (const auto& own : pool.climbers) {
+        const bool earlier = own->reached_at < winner->reached_at;
+        const bool fitter = own->reached_at == UINT_MAX && winner->reached_at == UINT_MAX && own->best.fitness > winner->best.fitness;
+        if (earlier || fitter)
+            winner = own.get();
+    }
+    best = winner->best;
+    snapshot.back() = best;
+    snapshot.publish();
+    generation.store(winner->reached_at != UINT_MAX ? winner->reached_at : pool.climbers.front()->generation.load());
+
+    running.store(false);
+    cancellation::worker_finished.notify();
+}
+
+void hill_climbing::color_worker(std::stop_token stop) {
+    if (color_climbers.climbers.size() > 1) {
+        climbers_worker<modes::color>(color_climbers, color_best, color_best_snapshot, telemetry::output, stop, color_running, color_generation, rng::derive_seed(seed, color_stream), color_target_fitness, max_iterations, mutation_log_capacity);
+        return;
     }
+    worker_loop<modes::color>(globals::target, color_current, color_best, &color_best_snapshot, nullptr, telemetry::output, color_failure_count, stop, color_running, color_generation, rng::derive_seed(seed, color_stream), color_target_fitness, max_iterations, mutation_log_capacity);
 }
 
-void hill_climbing::color_worker() {
-    worker_loop(color_current, color_best, best_color_mtx, color_failure_count, color_running, color_generation, calculate_fitness_color, mutate_color, initialize_color);
+void hill_climbing::gray_scale_worker(std::stop_token stop) {
+    if (gray_scale_climbers.climbers.size() > 1) {
+        climbers_worker<modes::gray>(gray_scale_climbers, gray_scale_best, gray_scale_best_snapshot, telemetry::output, stop, gray_scale_running, gray_scale_generation, rng::derive_seed(seed, gray_scale_stream), gray_scale_target_fitness, max_iterations, mutation_log_capacity);
+        return;
+    }
+    worker_loop<modes::gray>(globals::target, gray_scale_current, gray_scale_best, &gray_scale_best_snapshot, nullptr, telemetry::output, gray_scale_failure_count, stop, gray_scale_running, gray_scale_generation, rng::derive_seed(seed, gray_scale_stream), gray_scale_target_fitness, max_iterations, mutation_log_capacity);
+}
+
+void hill_climbing::binary_worker(std::stop_token stop) {
+    if (binary_climbers.climbers.size() > 1) {
+        climbers_worker<modes::binary>(binary_climbers, binary_best, binary_best_snapshot, telemetry::output, stop, binary_running, binary_generation, rng::derive_seed(seed, binary_stream), binary_target_fitness, max_iterations, mutation_log_capacity);
+        return;
+    }
+    worker_loop<modes::binary>(globals::target, binary_current, binary_best, &binary_best_snapshot, nullptr, telemetry::output, binary_failure_count, stop, binary_running, binary_generation, rng::derive_seed(seed, binary_stream), binary_target_fitness, max_iterations, mutation_log_capacity);
 }
 
-void hill_climbing::gray_scale_worker() {
-    worker_loop(gray_scale_current, gray_scale_best, best_gray_scale_mtx, gray_scale_failure_count, gray_scale_running, gray_scale_generation, calculate_fitness_gray_scale, mutate_grayscale, initialize_gray_scale);
+static size_t mutation_log_size(const globals::target_image& target) {
+    return target.bgra.size() / 256 + 64;
 }
 
-void hill_climbing::binary_worker() {
-    worker_loop(binary_current, binary_best, best_binary_mtx, binary_failure_count, binary_running, binary_generation, calculate_fitness_binary, mutate_binary, initialize_binary);
+void hill_climbing::randomize(individual& current, individual& best, const encoding::format format, const globals::target_image& target) {
+    randomize_genome(current, format, target);
+    best = current;
 }
 
 void hill_climbing::initialize_color() {
-    color_current.genome.resize(genome_size);
-    for (auto& genome : color_current.genome) {
-        genome = random_int(0, 255);
-    }
-    color_current.fitness = calculate_fitness_color(color_current);
-    color_best = color_current;
+    randomize(color_current, color_best, encoding::format::bgra, globals::target);
 }
 
 void hill_climbing::initialize_gray_scale() {
-    gray_scale_current.genome.resize(genome_size);
-    for (size_t i = 0; i < genome_size; i += 4) {
-        uint8_t gray = random_int(0, 255);
-        gray_scale_current.genome[i] = gray;
-        gray_scale_current.genome[i + 1] = gray;
-        gray_scale_current.genome[i + 2] = gray;
-        gray_scale_current.genome[i + 3] = 255;
-    }
-    gray_scale_current.fitness = calculate_fitness_gray_scale(gray_scale_current);
-    gray_scale_best = gray_scale_current;
+    randomize(gray_scale_current, gray_scale_best, encoding::format::luma, globals::target);
 }
 
 void hill_climbing::initialize_binary() {
-    binary_current.genome.resize(genome_size);
-    for (size_t i = 0; i < genome_size; i += 4) {
-        uint8_t val = random_int(0, 1) * 255;
-        binary_current.genome[i] = val;
-        binary_current.genome[i + 1] = val;
-        binary_current.genome[i + 2] = val;
-        binary_current.genome[i + 3] = 255;
-    }
+    randomize(binary_current, binary_best, encoding::format::bits, globals::target);
+}
 
-    binary_current.fitness = calculate_fitness_binary(binary_current);
-    binary_best = binary_current;
+static void initialize_climbers(hill_climbing::climber_pool& pool, const size_t genome_size) {
+    pool.climbers.clear();
+    if (hill_climbing::multi_start.climbers <= 1)
+        return;
+
+    // Climbers randomize themselves when they start; sizing their genomes
+    // here keeps restarts from allocating.
+    for (unsigned int index = 0; index < hill_climbing::multi_start.climbers; ++index) {
+        auto own = std::make_unique<hill_climbing::climber>();
+        own->current.genome.resize(genome_size);
+        own->best.genome.resize(genome_size);
+        pool.climbers.push_back(std::move(own));
+    }
+    // Every climber holds at most one buffer at a time, plus the best.
+    pool.global_best.reset(genome_size, pool.climbers.size() + 2);
+    pool.stop_iteration.store(UINT_MAX);
 }
 
 void hill_climbing::initialize() {
-	initialize_color();
-    initialize_gray_scale();
-    initialize_binary();
+    rng::seed_thread(rng::derive_seed(seed, initialize_stream));
 
-    std::thread color_worker_thread(color_worker);
-    std::thread gray_scale_worker_thread(gray_scale_worker);
-    std::thread binary_worker_thread(binary_worker);
+    pixel_count = globals::target.pixel_count();
+    color_genome_size = encoding::genome_size(encoding::format::bgra, pixel_count);
+    gray_scale_genome_size = encoding::genome_size(encoding::format::luma, pixel_count);
+    binary_genome_size = encoding::genome_size(encoding::format::bits, pixel_count);
+    mutation_log_capacity = mutation_log_size(globals::target);
 
-    MSG msg;
-    while (true) {
-        if (LI_FN(PeekMessageW)(&msg, renderer::overlay::hwnd, 0, 0, PM_REMOVE)) {
-            if (msg.message == WM_QUIT) break;
-            LI_FN(TranslateMessage)(&msg);
-            LI_FN(DispatchMessageW)(&msg);
-        }
+    color_generation.store(0);
+    gray_scale_generation.store(0);
+    binary_generation.store(0);
 
-        {
-            std::lock_guard<std::mutex> lock(best_color_mtx);
-            if (!color_best.genome.empty()) {
-                globals::current_color_bitmap->CopyFromMemory(nullptr, color_best.genome.data(), globals::image_width * 4);
-            }
-        }
+    color_failure_count = 0;
+    gray_scale_failure_count = 0;
+    binary_failure_count = 0;
 
-        {
-            std::lock_guard<std::mutex> lock(best_gray_scale_mtx);
-            if (!gray_scale_best.genome.empty()) {
-                globals::current_gray_scale_bitmap->CopyFromMemory(nullptr, gray_scale_best.genome.data(), globals::image_width * 4);
-            }
-        }
+    color_running.store(true);
+    gray_scale_running.store(true);
+    binary_running.store(true);
 
-        {
-            std::lock_guard<std::mutex> lock(best_binary_mtx);
-            if (!binary_best.genome.empty()) {
-                globals::current_binary_bitmap->CopyFromMemory(nullptr, binary_best.genome.data(), globals::image_width * 4);
-            }
-        }
+	initialize_color();
+    initialize_gray_scale();
+    initialize_binary();
 
-        renderer::d2d1::render_target->BeginDraw();
-        renderer::d2d1::render_target->Clear();
+    color_best_snapshot.reset(color_best);
+    gray_scale_best_snapshot.reset(gray_scale_best);
+    binary_best_snapshot.reset(binary_best);
 
-        auto font = GET_FONT(encrypt("verdana"), 13.f, DWRITE_FONT_WEIGHT_BOLD);
+    initialize_climbers(color_climbers, color_genome_size);
+    initialize_climbers(gray_scale_climbers, gray_scale_genome_size);
+    initialize_climbers(binary_climbers, binary_genome_size);
+}
 
-        vector2 goal_pos(spacing_x, top_y);
-        renderer::items::render_text(font, goal_pos + vector2(0.f, text_offset_y), L"Goal", COLOR_WHITE);
-        renderer::items::render_bitmap(globals::goal_bitmap, goal_pos, goal_pos + bitmap_size, 1.f);
+void hill_climbing::run(const globals::target_image& target, const run_config& config, run_state& state, std::stop_token stop) {
+    state.generation.store(0);
+    state.running.store(true);
+    state.failure_count = 0;
 
-        if (color_generation.load()) {
-            vector2 color_pos(goal_pos.x + globals::image_width + spacing_x * 5.f, top_y);
-            std::wstring text = L"Color Gen - Fitness: " + std::to_wstring(color_best.fitness) +
-                L" | Gen: " + std::to_wstring(color_generation.load());
-            renderer::items::render_text(font, color_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_color_bitmap, color_pos, vector2(color_pos.x + bitmap_size.x, color_pos.y + bitmap_size.y), 1.f);
-        }
+    const seed_stream stream = config.format == encoding::format::bgra ? color_stream : config.format == encoding::format::luma ? gray_scale_stream : binary_stream;
+    const uint64_t seed = rng::derive_seed(config.seed, stream);
+    const size_t log_capacity = mutation_log_size(target);
 
-        if (gray_scale_generation.load()) {
-            vector2 gray_pos(goal_pos.x + 2 * (globals::image_width + spacing_x * 5.f), top_y);
-            std::wstring text = L"Gray Gen - Fitness: " + std::to_wstring(gray_scale_best.fitness) +
-                L" | Gen: " + std::to_wstring(gray_scale_generation.load());
-            renderer::items::render_text(font, gray_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_gray_scale_bitmap, gray_pos, vector2(gray_pos.x + bitmap_size.x, gray_pos.y + bitmap_size.y), 1.f);
-        }
+    modes::visit(config.format, [&](auto mode) {
+        worker_loop<decltype(mode)>(target, state.current, state.best, nullptr, nullptr, nullptr, state.failure_count, stop, state.running, state.generation, seed, config.target_fitness, config.max_iterations, log_capacity);
+    });
+}
 
-        if (binary_generation.load()) {
-            vector2 bin_pos(goal_pos.x + 3 * (globals::image_width + spacing_x * 5.f), top_y);
-            std::wstring text = L"Binary Gen - Fitness: " + std::to_wstring(binary_best.fitness) +
-                L" | Gen: " + std::to_wstring(binary_generation.load());
-            renderer::items::render_text(font, bin_pos + vector2(0.f, text_offset_y), text.c_str(), COLOR_WHITE);
-            renderer::items::render_bitmap(globals::current_binary_bitmap, bin_pos, vector2(bin_pos.x + bitmap_size.x, bin_pos.y + bitmap_size.y), 1.f);
-        }
+void hill_climbing::start() {
+    color_worker_thread = std::jthread(color_worker);
+    gray_scale_worker_thread = std::jthread(gray_scale_worker);
+    binary_worker_thread = std::jthread(binary_worker);
+}
 
-        renderer::d2d1::render_target->EndDraw();
+void hill_climbing::stop() {
+    color_worker_thread.request_stop();
+    gray_scale_worker_thread.request_stop();
+    binary_worker_thread.request_stop();
+
+    if (color_worker_thread.joinable())
+        color_worker_thread.join();
+    if (gray_scale_worker_thread.joinable())
+        gray_scale_worker_thread.join();
+    if (binary_worker_thread.joinable())
+        binary_worker_thread.join();
+}
 
-        if (color_best.fitness >= 0.95)
-            color_running.store(false);
+bool hill_climbing::update_stop_conditions() {
+    return !color_running && !gray_scale_running && !binary_running;
+}
 
-        if (gray_scale_best.fitness >= 0.98)
-            gray_scale_running.store(false);
+static uint64_t digest_mode(const individual& best, const unsigned int iteration, const uint64_t val) {
+    uint64_t result = hash::fnv1a64(best.genome.data(), best.genome.size(), val);
+    result = hash::fnv1a64(&best.fitness, sizeof(best.fitness), result);
+    return hash::fnv1a64(&iteration, sizeof(iteration), result);
+}
 
-        if (binary_best.fitness >= 1)
-            binary_running.store(false);
+uint64_t hill_climbing::digest() {
+    uint64_t result = digest_mode(color_best, color_generation.load(), 0xCBF29CE484222325ULL);
+    result = digest_mode(gray_scale_best, gray_scale_generation.load(), result);
+    return digest_mode(binary_best, binary_generation.load(), result);
+}
 
-        if (GetAsyncKeyState(VK_END) & 0x8000 || (!color_running && !gray_scale_running && !binary_running)) {
-            LI_FN(PostQuitMessage)(0);
-            ExitProcess(0);
-            break;
-        }
+const char* hill_climbing::restart_name(const restart_strategy value) {
+    switch (value) {
+    case restart_strategy::random: return "random";
+    case restart_strategy::perturb_best: return "perturb-best";
+    case restart_strategy::iterated: return "iterated";
     }
+    return "unknown";
+}
 
-    color_running.store(false);
-    gray_scale_running.store(false);
-    binary_running.store(false);
-    color_worker_thread.join();
-    gray_scale_worker_thread.join();
-    binary_worker_thread.join();
-}
\ No newline at end of file
+bool hill_climbing::parse_restart(const char* name, restart_strategy& value) {
+    for (const restart_strategy candidate : { restart_strategy::random, restart_strategy::perturb_best, restart_strategy::iterated }) {
+        if (std::strcmp(name, restart_name(candidate)) == 0) {
+            value = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -1,28 +1,81 @@
 #pragma once
 
 #include <atomic>
-#include <mutex>
+#include <climits>
+#include <memory>
+#include <stop_token>
+#include <thread>
 #include <vector>
-#include "../globals.h"
+#include "../target.h"
+#include "../utilities/encoding.h"
 #include "../utilities/individual.h"
+#include "../utilities/random.h"
+#include "../utilities/shared_best.h"
+#include "../utilities/triple_buffer.h"
 
 namespace hill_climbing {
-    inline constexpr float spacing_x = 75.f;
-    inline constexpr float top_y = 100.f;
-    inline constexpr float text_offset_y = -25.f;
-    inline const vector2 bitmap_size(globals::image_width * 5.f, globals::image_height * 5.f);
-
-    inline const std::chrono::seconds pause_duration(10);
-
-    inline constexpr unsigned int interval = 15'000U;
+    // Iterations between CPU budget checks (utilities/throttle.h); a few
+    // hundred iterations take tens of microseconds.
+    inline constexpr unsigned int throttle_check_interval = 256U;
+    // An improved best reaches *_best_snapshot at most this many iterations
+    // later, so frequent small improvements do not each cost a genome copy.
+    inline constexpr unsigned int publish_interval = 256U;
     inline constexpr unsigned int failure_threshold = 90'000U;
-    inline constexpr unsigned int genome_size = globals::image_width * globals::image_height * 4;
+    // Iterations per worker before it stops on its own, 0 = unlimited.
+    inline unsigned int max_iterations = 0U;
+    // Sizes of the current target (globals::target), set by initialize().
+    inline size_t pixel_count = 0;
+    inline size_t color_genome_size = 0;
+    inline size_t gray_scale_genome_size = 0;
+    inline size_t binary_genome_size = 0;
+    // Enough room for the expected number of mutations at the maximum rate, so
+    // the log never reallocates in steady state. Set by initialize().
+    inline size_t mutation_log_capacity = 0;
     //inline float mutation_rate = 0.0001f;
 
+    inline constexpr float color_target_fitness = 0.95f;
+    inline constexpr float gray_scale_target_fitness = 0.98f;
+    inline constexpr float binary_target_fitness = 1.f;
+
+    // What a climber does after failure_threshold failed steps.
+    enum class restart_strategy {
+        // Start over from a random individual.
+        random,
+        // Perturb a copy of the best individual any climber of the mode found.
+        perturb_best,
+        // Iterated local search: perturb the climber's own best, so it keeps
+        // climbing from the best local optimum it reached.
+        iterated
+    };
+
+    struct multi_start_config {
+        // Independent climbers per mode, each on its own thread; 1 = the
+        // single classic climber.
+        unsigned int climbers = 1U;
+        restart_strategy restart = restart_strategy::random;
+        // Share of genes (pixels for binary) a perturbing restart randomizes.
+        float perturbation = 0.02f;
+    };
+
+    // Read by initialize().
+    inline multi_start_config multi_start{};
+
     inline individual color_current;
     inline individual gray_scale_current;
     inline individual binary_current;
 
+    // Every worker seeds its thread's engine from this, see rng::derive_seed.
+    inline uint64_t seed = rng::random_seed();
+
+    enum seed_stream : uint64_t {
+        color_stream,
+        gray_scale_stream,
+        binary_stream,
+        initialize_stream
+    };
+
+    // Set while a mode's worker runs; cleared when it finishes on its own
+    // or after a stop request (see cancellation::worker_finished).
     inline std::atomic<bool> color_running{ true };
     inline std::atomic<bool> gray_scale_running{ true };
     inline std::atomic<bool> binary_running{ true };
@@ -31,33 +84,104 @@ namespace hill_climbing {
     inline std::atomic<unsigned int> gray_scale_generation{ 0 };
     inline std::atomic<unsigned int> binary_generation{ 0 };
 
-    inline std::mutex best_color_mtx;
-    inline std::mutex best_gray_scale_mtx;
-    inline std::mutex best_binary_mtx;
-
+    // Owned by the mode's worker while it runs; read them after stop().
     inline individual color_best;
     inline individual gray_scale_best;
     inline individual binary_best;
 
+    // Copies of *_best published by the worker; one other thread (the
+    // overlay or the headless reporter) may read each.
+    inline triple_buffer<individual> color_best_snapshot;
+    inline triple_buffer<individual> gray_scale_best_snapshot;
+    inline triple_buffer<individual> binary_best_snapshot;
+
 	inline unsigned int color_failure_count = 0;
 	inline unsigned int gray_scale_failure_count = 0;
 	inline unsigned int binary_failure_count = 0;
 
+    // One of a mode's climbers when multi_start.climbers > 1. Unlike the
+    // single climber its best survives restarts.
+    struct climber {
+        individual current;
+        individual best;
+        unsigned int failure_count = 0;
+        // Iteration at which its best reached the target fitness, UINT_MAX
+        // if it did not.
+        unsigned int reached_at = UINT_MAX;
+        std::atomic<bool> running{ true };
+        std::atomic<unsigned int> generation{ 0 };
+    };
+
+    struct climber_pool {
+        // Empty unless multi_start.climbers > 1.
+        std::vector<std::unique_ptr<climber>> climbers;
+        // Lowest-error individual of any climber; climber 0, on the mode's
+        // worker thread, copies it into the mode's best and snapshot.
+        shared_best global_best;
+        // Lowest iteration at which any climber reached the target fitness.
+        // Every climber runs until it reaches the target itself or gets this
+        // far, so which climber reached it first does not depend on timing.
+        std::atomic<unsigned int> stop_iteration{ UINT_MAX };
+    };
+
+    inline climber_pool color_climbers;
+    inline climber_pool gray_scale_climbers;
+    inline climber_pool binary_climbers;
+
+    inline std::jthread color_worker_thread;
+    inline std::jthread gray_scale_worker_thread;
+    inline std::jthread binary_worker_thread;
+
     void initialize();
+    void start();
+    // Asks every worker to stop and joins them; a worker notices within one
+    // step, and best already holds its last improvement.
+    void stop();
+    bool update_stop_conditions();
+    // Hash of every mode's best genome, fitness and iteration count; equal
+    // digests after two runs with the same seed and budget mean identical runs.
+    uint64_t digest();
 
     void initialize_color();
     void initialize_gray_scale();
     void initialize_binary();
 
-    void color_worker();
-    void gray_scale_worker();
-    void binary_worker();
+    void color_worker(std::stop_token stop);
+    void gray_scale_worker(std::stop_token stop);
+    void binary_worker(std::stop_token stop);
+
+    // Mutates current in place and keeps the change if it improves fitness,
+    // otherwise rolls it back from the log. Returns whether the step was accepted.
+    bool step_color(individual& current, mutation_log& log, const globals::target_image& target);
+    bool step_gray_scale(individual& current, mutation_log& log, const globals::target_image& target);
+    bool step_binary(individual& current, mutation_log& log, const globals::target_image& target);
+
+    const char* restart_name(restart_strategy value);
+    // Returns false and leaves value untouched for an unknown name.
+    bool parse_restart(const char* name, restart_strategy& value);
+
+    // Replaces current with a random individual of the given format and makes it the best so far.
+    void randomize(individual& current, individual& best, encoding::format format, const globals::target_image& target);
+
+    // One mode climbing towards an explicit target with state of its own,
+    // independent of the per-mode globals above (used by the batch runner).
+    struct run_config {
+        encoding::format format = encoding::format::bgra;
+        float target_fitness = 1.f;
+        // 0 = until target_fitness is reached or a stop is requested.
+        unsigned int max_iterations = 0U;
+        uint64_t seed = 0;
+    };
 
-    void mutate_color(individual& ind, const float& mutation_rate);
-    void mutate_grayscale(individual& ind, const float& mutation_rate);
-    void mutate_binary(individual& ind, const float& mutation_rate);
+    struct run_state {
+        individual current;
+        individual best;
+        std::atomic<bool> running{ true };
+        std::atomic<unsigned int> generation{ 0 };
+        unsigned int failure_count = 0;
+    };
 
-    float calculate_fitness_color(const individual& ind);
-    float calculate_fitness_gray_scale(const individual& ind);
-    float calculate_fitness_binary(const individual& ind);
+    // Initializes state and climbs on the calling thread until a stop
+    // condition is met or stop is requested.
+    void run(const globals::target_image& target, const run_config& config, run_state& state, std::stop_token stop = {});
 }
@@ -0,0 +1,42 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace image {
+    // CRC-32 as used by PNG chunks; pass the previous result to continue a running checksum.
+    inline uint32_t crc32(const uint8_t* data, const size_t size, uint32_t crc = 0) {
+        static const auto table = [] {
+            std::array<uint32_t, 256> result{};
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+                result[n] = c;
+            }
+            return result;
+        }();
+
+        uint32_t c = crc ^ 0xFFFFFFFFU;
+        for (size_t i = 0; i < size; ++i)
+            c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+        return c ^ 0xFFFFFFFFU;
+    }
+
+    // Adler-32 as used by the zlib trailer; pass the previous result to continue.
+    inline uint32_t adler32(const uint8_t* data, const size_t size, const uint32_t adler = 1) {
+        uint32_t a = adler & 0xFFFF, b = adler >> 16;
+        // 5552 bytes is the most that can be summed before b may overflow 32 bits.
+        for (size_t chunk = 0; chunk < size; chunk += 5552) {
+            const size_t end = std::min<size_t>(chunk + 5552, size);
+            for (size_t i = chunk; i < end; ++i) {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        return (b << 16) | a;
+    }
+}
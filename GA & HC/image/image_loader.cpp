@@ -0,0 +1,266 @@
+#include "image_loader.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+// Refuse images whose BGRA buffer would not fit comfortably in memory.
+static constexpr size_t max_pixel_count = size_t(1) << 28;
+
+static bool valid_size(const size_t width, const size_t height, std::string& error) {
+    if (width == 0 || height == 0 || width > max_pixel_count / height) {
+        error = "unsupported image size " + std::to_string(width) + "x" + std::to_string(height);
+        return false;
+    }
+    return true;
+}
+
+bool image::load(const char* path, bitmap& out, std::string& error) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        error = std::string("cannot open '") + path + "'";
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[1 << 16];
+    size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+        data.insert(data.end(), chunk, chunk + read);
+    const bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+
+    if (failed) {
+        error = std::string("cannot read '") + path + "'";
+        return false;
+    }
+    return decode(data.data(), data.size(), out, error);
+}
+
+bool image::decode(const uint8_t* data, const size_t size, bitmap& out, std::string& error) {
+    static constexpr uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    if (size >= 8 && std::memcmp(data, png_signature, 8) == 0)
+        return decode_png(data, size, out, error);
+    if (size >= 2 && data[0] == 'B' && data[1] == 'M')
+        return decode_bmp(data, size, out, error);
+    if (size >= 2 && data[0] == 'P' && std::strchr("2356", data[1]) && data[1] != '\0')
+        return decode_pnm(data, size, out, error);
+
+    error = "unrecognized image format (expected PNG, BMP, PPM or PGM)";
+    return false;
+}
+
+namespace {
+    struct pnm_reader {
+        const uint8_t* data;
+        size_t size;
+        size_t position = 0;
+
+        void skip_space() {
+            while (position < size) {
+                if (data[position] == '#') {
+                    while (position < size && data[position] != '\n')
+                        ++position;
+                }
+                else if (std::isspace(data[position]))
+                    ++position;
+                else
+                    break;
+            }
+        }
+
+        bool number(unsigned int& value) {
+            skip_space();
+            if (position >= size || !std::isdigit(data[position]))
+                return false;
+            uint64_t result = 0;
+            while (position < size && std::isdigit(data[position])) {
+                result = result * 10 + (data[position++] - '0');
+                if (result > 0xFFFFFFFFULL)
+                    return false;
+            }
+            value = static_cast<unsigned int>(result);
+            return true;
+        }
+    };
+}
+
+bool image::decode_pnm(const uint8_t* data, const size_t size, bitmap& out, std::string& error) {
+    const char kind = static_cast<char>(data[1]);
+    const bool ascii = kind == '2' || kind == '3';
+    const unsigned int channels = (kind == '3' || kind == '6') ? 3 : 1;
+
+    pnm_reader reader{ data, size, 2 };
+    unsigned int width, height, max_value;
+    if (!reader.number(width) || !reader.number(height) || !reader.number(max_value) || max_value == 0 || max_value > 65535) {
+        error = "corrupt PNM header";
+        return false;
+    }
+    if (!valid_size(width, height, error))
+        return false;
+
+    const size_t sample_count = static_cast<size_t>(width) * height * channels;
+    const size_t sample_bytes = max_value > 255 ? 2 : 1;
+    if (!ascii) {
+        // Exactly one whitespace byte separates the header from the raster.
+        reader.position++;
+        if (reader.position > size || size - reader.position < sample_count * sample_bytes) {
+            error = "truncated PNM raster";
+            return false;
+        }
+    }
+
+    out.width = width;
+    out.height = height;
+    out.bgra.assign(static_cast<size_t>(width) * height * 4, 255);
+
+    for (size_t i = 0; i < sample_count; ++i) {
+        unsigned int sample;
+        if (ascii) {
+            if (!reader.number(sample) || sample > max_value) {
+                error = "corrupt PNM sample";
+                return false;
+            }
+        }
+        else if (sample_bytes == 2) {
+            sample = (data[reader.position] << 8) | data[reader.position + 1];
+            reader.position += 2;
+        }
+        else
+            sample = data[reader.position++];
+
+        const uint8_t value = static_cast<uint8_t>(std::min(sample, max_value) * 255U / max_value);
+        const size_t pixel = i / channels;
+        if (channels == 1) {
+            out.bgra[pixel * 4 + 0] = value;
+            out.bgra[pixel * 4 + 1] = value;
+            out.bgra[pixel * 4 + 2] = value;
+        }
+        else {
+            // PPM samples are R, G, B.
+            out.bgra[pixel * 4 + 2 - i % 3] = value;
+        }
+    }
+    return true;
+}
+
+static uint32_t read_le32(const uint8_t* data) {
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint16_t read_le16(const uint8_t* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+// Scales the bits of value selected by mask to 0..255.
+static uint8_t extract_channel(const uint32_t value, const uint32_t mask) {
+    if (!mask)
+        return 255;
+    int shift = 0;
+    while (!((mask >> shift) & 1))
+        ++shift;
+    const uint32_t max_value = mask >> shift;
+    return static_cast<uint8_t>(((value & mask) >> shift) * 255ULL / max_value);
+}
+
+bool image::decode_bmp(const uint8_t* data, const size_t size, bitmap& out, std::string& error) {
+    if (size < 54) {
+        error = "truncated BMP header";
+        return false;
+    }
+
+    const uint32_t pixel_offset = read_le32(data + 10);
+    const uint32_t header_size = read_le32(data + 14);
+    if (header_size < 40 || 14 + static_cast<size_t>(header_size) > size) {
+        error = "unsupported BMP header";
+        return false;
+    }
+
+    const int32_t raw_width = static_cast<int32_t>(read_le32(data + 18));
+    const int32_t raw_height = static_cast<int32_t>(read_le32(data + 22));
+    const uint16_t bits_per_pixel = read_le16(data + 28);
+    const uint32_t compression = read_le32(data + 30);
+    uint32_t palette_size = read_le32(data + 46);
+
+    const bool top_down = raw_height < 0;
+    const size_t width = raw_width > 0 ? static_cast<size_t>(raw_width) : 0;
+    const size_t height = top_down ? static_cast<size_t>(-static_cast<int64_t>(raw_height)) : static_cast<size_t>(raw_height);
+    if (!valid_size(width, height, error))
+        return false;
+
+    uint32_t masks[4] = { 0x00FF0000, 0x0000FF00, 0x000000FF, 0 };
+    if (compression == 3 && bits_per_pixel == 32) {
+        // BI_BITFIELDS: masks follow a 40-byte header or live inside a V4/V5 header.
+        if (14 + 40 + 12 > size) {
+            error = "truncated BMP bitfields";
+            return false;
+        }
+        for (int i = 0; i < 3; ++i)
+            masks[i] = read_le32(data + 54 + i * 4);
+        if (header_size >= 56)
+            masks[3] = read_le32(data + 54 + 12);
+    }
+    else if (compression != 0) {
+        error = "compressed BMPs are not supported";
+        return false;
+    }
+
+    const bool paletted = bits_per_pixel == 1 || bits_per_pixel == 4 || bits_per_pixel == 8;
+    if (!paletted && bits_per_pixel != 24 && bits_per_pixel != 32) {
+        error = "unsupported BMP bit depth " + std::to_string(bits_per_pixel);
+        return false;
+    }
+
+    const uint8_t* palette = data + 14 + header_size;
+    if (paletted) {
+        if (palette_size == 0 || palette_size > (1U << bits_per_pixel))
+            palette_size = 1U << bits_per_pixel;
+        if (static_cast<size_t>(palette - data) + palette_size * 4 > size) {
+            error = "truncated BMP palette";
+            return false;
+        }
+    }
+
+    const size_t row_bytes = (width * bits_per_pixel + 31) / 32 * 4;
+    if (pixel_offset > size || (size - pixel_offset) / row_bytes < height) {
+        error = "truncated BMP pixel data";
+        return false;
+    }
+
+    out.width = static_cast<unsigned int>(width);
+    out.height = static_cast<unsigned int>(height);
+    out.bgra.resize(width * height * 4);
+
+    for (size_t y = 0; y < height; ++y) {
+        const uint8_t* row = data + pixel_offset + (top_down ? y : height - 1 - y) * row_bytes;
+        uint8_t* target = out.bgra.data() + y * width * 4;
+
+        for (size_t x = 0; x < width; ++x) {
+            uint8_t* pixel = target + x * 4;
+            if (paletted) {
+                const size_t bit = x * bits_per_pixel;
+                const uint32_t index = (row[bit / 8] >> (8 - bits_per_pixel - bit % 8)) & ((1U << bits_per_pixel) - 1U);
+                const uint8_t* entry = palette + std::min(index, palette_size - 1) * 4;
+                pixel[0] = entry[0];
+                pixel[1] = entry[1];
+                pixel[2] = entry[2];
+                pixel[3] = 255;
+            }
+            else if (bits_per_pixel == 24) {
+                pixel[0] = row[x * 3 + 0];
+                pixel[1] = row[x * 3 + 1];
+                pixel[2] = row[x * 3 + 2];
+                pixel[3] = 255;
+            }
+            else {
+                const uint32_t value = read_le32(row + x * 4);
+                pixel[0] = extract_channel(value, masks[2]);
+                pixel[1] = extract_channel(value, masks[1]);
+                pixel[2] = extract_channel(value, masks[0]);
+                pixel[3] = extract_channel(value, masks[3]);
+            }
+        }
+    }
+    return true;
+}
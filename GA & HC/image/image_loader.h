@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace image {
+    // Straight (not premultiplied) BGRA pixels, rows top to bottom.
+    struct bitmap {
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<uint8_t> bgra;
+    };
+
+    // Reads a PNG, BMP or PPM/PGM file, detected from its contents. On
+    // failure returns false and describes the problem in error.
+    bool load(const char* path, bitmap& out, std::string& error);
+    bool decode(const uint8_t* data, size_t size, bitmap& out, std::string& error);
+
+    // Netpbm P2/P3/P5/P6, any maxval up to 65535.
+    bool decode_pnm(const uint8_t* data, size_t size, bitmap& out, std::string& error);
+    // Uncompressed 1/4/8-bit palette, 24-bit and 32-bit (BI_RGB or BI_BITFIELDS) BMPs.
+    bool decode_bmp(const uint8_t* data, size_t size, bitmap& out, std::string& error);
+    // Every PNG color type and bit depth, including Adam7 interlacing and tRNS.
+    bool decode_png(const uint8_t* data, size_t size, bitmap& out, std::string& error);
+}
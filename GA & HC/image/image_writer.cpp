@@ -0,0 +1,72 @@
+#include "image_writer.h"
+#include <algorithm>
+#include <cstdio>
+#include "checksum.h"
+
+static void put_be32(std::vector<uint8_t>& out, const uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+static void put_chunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& body) {
+    put_be32(out, static_cast<uint32_t>(body.size()));
+    const size_t type_offset = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), body.begin(), body.end());
+    put_be32(out, image::crc32(out.data() + type_offset, out.size() - type_offset));
+}
+
+void image::encode_png(const bitmap& image, std::vector<uint8_t>& out) {
+    static constexpr uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    out.assign(signature, signature + 8);
+
+    std::vector<uint8_t> header;
+    put_be32(header, image.width);
+    put_be32(header, image.height);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });
+    put_chunk(out, "IHDR", header);
+
+    // Filter type 0 rows, RGBA order.
+    std::vector<uint8_t> raw;
+    raw.reserve((static_cast<size_t>(image.width) * 4 + 1) * image.height);
+    for (size_t y = 0; y < image.height; ++y) {
+        raw.push_back(0);
+        const uint8_t* row = image.bgra.data() + y * image.width * 4;
+        for (size_t x = 0; x < image.width; ++x) {
+            raw.insert(raw.end(), { row[x * 4 + 2], row[x * 4 + 1], row[x * 4 + 0], row[x * 4 + 3] });
+        }
+    }
+
+    // Results are small, so the zlib stream uses stored (uncompressed) deflate blocks.
+    std::vector<uint8_t> stream = { 0x78, 0x01 };
+    for (size_t position = 0; position < raw.size();) {
+        const size_t length = std::min<size_t>(raw.size() - position, 65535);
+        const bool last = position + length == raw.size();
+        stream.insert(stream.end(), { static_cast<uint8_t>(last), static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8),
+            static_cast<uint8_t>(~length), static_cast<uint8_t>(~length >> 8) });
+        stream.insert(stream.end(), raw.begin() + position, raw.begin() + position + length);
+        position += length;
+    }
+    put_be32(stream, adler32(raw.data(), raw.size()));
+    put_chunk(out, "IDAT", stream);
+    put_chunk(out, "IEND", {});
+}
+
+bool image::save_png(const char* path, const bitmap& image, std::string& error) {
+    std::vector<uint8_t> data;
+    encode_png(image, data);
+
+    std::FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        error = std::string("cannot create '") + path + "'";
+        return false;
+    }
+    const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    if (std::fclose(file) != 0 || !written) {
+        error = std::string("cannot write '") + path + "'";
+        return false;
+    }
+    return true;
+}
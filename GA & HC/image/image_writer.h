@@ -0,0 +1,10 @@
+#pragma once
+#include <string>
+#include "image_loader.h"
+
+namespace image {
+    // Writes straight BGRA pixels as an 8-bit RGBA PNG. On failure returns
+    // false and describes the problem in error.
+    bool save_png(const char* path, const bitmap& image, std::string& error);
+    void encode_png(const bitmap& image, std::vector<uint8_t>& out);
+}
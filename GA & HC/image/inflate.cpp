@@ -0,0 +1,296 @@
+#include "inflate.h"
+#include <algorithm>
+#include <array>
+#include "checksum.h"
+
+namespace {
+    constexpr int max_bits = 15;
+
+    struct bit_reader {
+        const uint8_t* data;
+        size_t size;
+        size_t position = 0;
+        uint32_t buffer = 0;
+        int count = 0;
+        bool overrun = false;
+
+        uint32_t bits(const int needed) {
+            while (count < needed) {
+                if (position >= size) {
+                    overrun = true;
+                    return 0;
+                }
+                buffer |= static_cast<uint32_t>(data[position++]) << count;
+                count += 8;
+            }
+            const uint32_t value = buffer & ((1U << needed) - 1U);
+            buffer >>= needed;
+            count -= needed;
+            return value;
+        }
+
+        void align() {
+            buffer = 0;
+            count = 0;
+        }
+    };
+
+    // Canonical Huffman code: symbols sorted by code length, decoded one bit
+    // at a time against the first code of each length.
+    struct huffman {
+        std::array<uint16_t, max_bits + 1> counts{};
+        std::array<uint16_t, 288> symbols{};
+
+        bool build(const uint8_t* lengths, const int symbol_count) {
+            counts.fill(0);
+            for (int i = 0; i < symbol_count; ++i)
+                counts[lengths[i]]++;
+            counts[0] = 0;
+
+            int left = 1;
+            for (int length = 1; length <= max_bits; ++length) {
+                left = (left << 1) - counts[length];
+                if (left < 0)
+                    return false;
+            }
+
+            std::array<uint16_t, max_bits + 1> offsets{};
+            for (int length = 1; length < max_bits; ++length)
+                offsets[length + 1] = offsets[length] + counts[length];
+            for (int i = 0; i < symbol_count; ++i) {
+                if (lengths[i])
+                    symbols[offsets[lengths[i]]++] = static_cast<uint16_t>(i);
+            }
+            return true;
+        }
+
+        int decode(bit_reader& reader) const {
+            int code = 0, first = 0, index = 0;
+            for (int length = 1; length <= max_bits; ++length) {
+                code |= static_cast<int>(reader.bits(1));
+                if (reader.overrun)
+                    return -1;
+                const int count = counts[length];
+                if (code - count < first)
+                    return symbols[index + (code - first)];
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+    };
+
+    constexpr uint16_t length_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    constexpr uint8_t length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    constexpr uint16_t distance_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    constexpr uint8_t distance_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    constexpr const char* too_large = "output larger than expected";
+
+    // start is where this stream's output begins in out, limit the size out may reach.
+    bool inflate_codes(bit_reader& reader, const huffman& literals, const huffman& distances, std::vector<uint8_t>& out, const size_t start, const size_t limit, std::string& error) {
+        while (true) {
+            const int symbol = literals.decode(reader);
+            if (symbol < 0) {
+                error = "invalid literal/length code";
+                return false;
+            }
+            if (symbol < 256) {
+                if (out.size() >= limit) {
+                    error = too_large;
+                    return false;
+                }
+                out.push_back(static_cast<uint8_t>(symbol));
+                continue;
+            }
+            if (symbol == 256)
+                return true;
+
+            const int length_index = symbol - 257;
+            if (length_index >= 29) {
+                error = "invalid length symbol";
+                return false;
+            }
+            const size_t length = length_base[length_index] + reader.bits(length_extra[length_index]);
+
+            const int distance_index = distances.decode(reader);
+            if (distance_index < 0 || distance_index >= 30) {
+                error = "invalid distance code";
+                return false;
+            }
+            const size_t distance = distance_base[distance_index] + reader.bits(distance_extra[distance_index]);
+            if (reader.overrun || distance > out.size() - start) {
+                error = "distance too far back";
+                return false;
+            }
+            if (length > limit - out.size()) {
+                error = too_large;
+                return false;
+            }
+
+            const size_t from = out.size() - distance;
+            for (size_t i = 0; i < length; ++i)
+                out.push_back(out[from + i]);
+        }
+    }
+
+    bool inflate_stored(bit_reader& reader, std::vector<uint8_t>& out, const size_t limit, std::string& error) {
+        reader.align();
+        if (reader.position + 4 > reader.size) {
+            error = "truncated stored block";
+            return false;
+        }
+        const uint8_t* header = reader.data + reader.position;
+        const uint16_t length = static_cast<uint16_t>(header[0] | (header[1] << 8));
+        const uint16_t complement = static_cast<uint16_t>(header[2] | (header[3] << 8));
+        reader.position += 4;
+
+        if (length != static_cast<uint16_t>(~complement) || reader.position + length > reader.size) {
+            error = "corrupt stored block";
+            return false;
+        }
+        if (length > limit - out.size()) {
+            error = too_large;
+            return false;
+        }
+        out.insert(out.end(), reader.data + reader.position, reader.data + reader.position + length);
+        reader.position += length;
+        return true;
+    }
+
+    bool inflate_fixed(bit_reader& reader, std::vector<uint8_t>& out, const size_t start, const size_t limit, std::string& error) {
+        static const auto tables = [] {
+            std::array<uint8_t, 288> lengths{};
+            for (int i = 0; i < 144; ++i) lengths[i] = 8;
+            for (int i = 144; i < 256; ++i) lengths[i] = 9;
+            for (int i = 256; i < 280; ++i) lengths[i] = 7;
+            for (int i = 280; i < 288; ++i) lengths[i] = 8;
+
+            std::pair<huffman, huffman> result;
+            result.first.build(lengths.data(), 288);
+            lengths.fill(5);
+            result.second.build(lengths.data(), 30);
+            return result;
+        }();
+        return inflate_codes(reader, tables.first, tables.second, out, start, limit, error);
+    }
+
+    bool inflate_dynamic(bit_reader& reader, std::vector<uint8_t>& out, const size_t start, const size_t limit, std::string& error) {
+        static constexpr uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        const int literal_count = static_cast<int>(reader.bits(5)) + 257;
+        const int distance_count = static_cast<int>(reader.bits(5)) + 1;
+        const int code_count = static_cast<int>(reader.bits(4)) + 4;
+        if (literal_count > 286 || distance_count > 30) {
+            error = "bad code counts";
+            return false;
+        }
+
+        std::array<uint8_t, 320> lengths{};
+        for (int i = 0; i < code_count; ++i)
+            lengths[order[i]] = static_cast<uint8_t>(reader.bits(3));
+
+        huffman code_lengths;
+        if (!code_lengths.build(lengths.data(), 19)) {
+            error = "bad code length code";
+            return false;
+        }
+
+        lengths.fill(0);
+        for (int i = 0; i < literal_count + distance_count;) {
+            const int symbol = code_lengths.decode(reader);
+            if (symbol < 0) {
+                error = "invalid code length";
+                return false;
+            }
+            if (symbol < 16) {
+                lengths[i++] = static_cast<uint8_t>(symbol);
+                continue;
+            }
+
+            uint8_t value = 0;
+            int repeat = 0;
+            if (symbol == 16) {
+                if (i == 0) {
+                    error = "repeat without a previous length";
+                    return false;
+                }
+                value = lengths[i - 1];
+                repeat = 3 + static_cast<int>(reader.bits(2));
+            }
+            else if (symbol == 17)
+                repeat = 3 + static_cast<int>(reader.bits(3));
+            else
+                repeat = 11 + static_cast<int>(reader.bits(7));
+
+            if (i + repeat > literal_count + distance_count) {
+                error = "too many code lengths";
+                return false;
+            }
+            while (repeat--)
+                lengths[i++] = value;
+        }
+
+        if (lengths[256] == 0) {
+            error = "missing end-of-block code";
+            return false;
+        }
+
+        huffman literals, distances;
+        if (!literals.build(lengths.data(), literal_count) || !distances.build(lengths.data() + literal_count, distance_count)) {
+            error = "oversubscribed code";
+            return false;
+        }
+        return inflate_codes(reader, literals, distances, out, start, limit, error);
+    }
+}
+
+bool image::zlib_decompress(const uint8_t* data, const size_t size, const size_t max_size, std::vector<uint8_t>& out, std::string& error) {
+    if (size < 6 || (data[0] & 0x0F) != 8 || ((data[0] << 8) | data[1]) % 31 != 0) {
+        error = "not a zlib stream";
+        return false;
+    }
+    if (data[1] & 0x20) {
+        error = "zlib preset dictionaries are not supported";
+        return false;
+    }
+
+    const size_t start = out.size();
+    const size_t limit = max_size > SIZE_MAX - start ? SIZE_MAX : start + max_size;
+    bit_reader reader{ data + 2, size - 2 };
+
+    bool last = false;
+    while (!last) {
+        last = reader.bits(1) != 0;
+        const uint32_t type = reader.bits(2);
+
+        bool ok = false;
+        switch (type) {
+        case 0: ok = inflate_stored(reader, out, limit, error); break;
+        case 1: ok = inflate_fixed(reader, out, start, limit, error); break;
+        case 2: ok = inflate_dynamic(reader, out, start, limit, error); break;
+        default: error = "invalid block type"; break;
+        }
+        if (reader.overrun) {
+            error = "truncated deflate stream";
+            return false;
+        }
+        if (!ok)
+            return false;
+    }
+
+    reader.align();
+    if (reader.position + 4 > reader.size) {
+        error = "missing Adler-32 checksum";
+        return false;
+    }
+
+    const uint8_t* trailer = reader.data + reader.position;
+    const uint32_t expected = (static_cast<uint32_t>(trailer[0]) << 24) | (trailer[1] << 16) | (trailer[2] << 8) | trailer[3];
+    if (adler32(out.data() + start, out.size() - start) != expected) {
+        error = "Adler-32 mismatch";
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace image {
+    // Decompresses a zlib stream (RFC 1950 wrapper around RFC 1951 deflate)
+    // and appends the result to out. Checks the Adler-32 trailer. Fails as
+    // soon as the output would exceed max_size bytes, so a small stream
+    // cannot expand without bound.
+    bool zlib_decompress(const uint8_t* data, size_t size, size_t max_size, std::vector<uint8_t>& out, std::string& error);
+}
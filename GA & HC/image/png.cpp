@@ -0,0 +1,296 @@
+#include "image_loader.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include "checksum.h"
+#include "inflate.h"
+
+namespace {
+    uint32_t read_be32(const uint8_t* data) {
+        return (static_cast<uint32_t>(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+    }
+
+    uint8_t paeth(const int a, const int b, const int c) {
+        const int p = a + b - c;
+        const int pa = p > a ? p - a : a - p;
+        const int pb = p > b ? p - b : b - p;
+        const int pc = p > c ? p - c : c - p;
+        if (pa <= pb && pa <= pc)
+            return static_cast<uint8_t>(a);
+        return static_cast<uint8_t>(pb <= pc ? b : c);
+    }
+
+    struct png_header {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint8_t bit_depth = 0;
+        uint8_t color_type = 0;
+        uint8_t interlace = 0;
+
+        unsigned int channels() const {
+            switch (color_type) {
+            case 2: return 3;
+            case 4: return 2;
+            case 6: return 4;
+            default: return 1;
+            }
+        }
+
+        size_t row_bytes(const size_t width_pixels) const {
+            return (width_pixels * channels() * bit_depth + 7) / 8;
+        }
+    };
+
+    struct png_palette {
+        std::array<uint8_t, 256 * 4> entries{};
+        size_t count = 0;
+        // tRNS color key for gray (first value) and RGB images, in sample units.
+        bool has_key = false;
+        uint16_t key[3] = {};
+    };
+
+    // Reverses the scanline filters of one (sub)image in place; rows are
+    // prefixed with their filter type byte.
+    bool unfilter(uint8_t* data, const size_t row_bytes, const size_t rows, const size_t bytes_per_pixel) {
+        const uint8_t* previous = nullptr;
+        for (size_t y = 0; y < rows; ++y) {
+            uint8_t* row = data + y * (row_bytes + 1);
+            const uint8_t filter = row[0];
+            uint8_t* pixels = row + 1;
+
+            for (size_t i = 0; i < row_bytes; ++i) {
+                const int left = i >= bytes_per_pixel ? pixels[i - bytes_per_pixel] : 0;
+                const int up = previous ? previous[i] : 0;
+                const int up_left = previous && i >= bytes_per_pixel ? previous[i - bytes_per_pixel] : 0;
+
+                switch (filter) {
+                case 0: break;
+                case 1: pixels[i] = static_cast<uint8_t>(pixels[i] + left); break;
+                case 2: pixels[i] = static_cast<uint8_t>(pixels[i] + up); break;
+                case 3: pixels[i] = static_cast<uint8_t>(pixels[i] + ((left + up) >> 1)); break;
+                case 4: pixels[i] = static_cast<uint8_t>(pixels[i] + paeth(left, up, up_left)); break;
+                default: return false;
+                }
+            }
+            previous = pixels;
+        }
+        return true;
+    }
+
+    uint16_t sample(const uint8_t* row, const size_t index, const uint8_t bit_depth) {
+        switch (bit_depth) {
+        case 16: return static_cast<uint16_t>((row[index * 2] << 8) | row[index * 2 + 1]);
+        case 8: return row[index];
+        default: {
+            const size_t bit = index * bit_depth;
+            return static_cast<uint16_t>((row[bit / 8] >> (8 - bit_depth - bit % 8)) & ((1U << bit_depth) - 1U));
+        }
+        }
+    }
+
+    uint8_t to_8bit(const uint16_t value, const uint8_t bit_depth) {
+        if (bit_depth == 16)
+            return static_cast<uint8_t>(value >> 8);
+        return static_cast<uint8_t>(value * 255U / ((1U << bit_depth) - 1U));
+    }
+
+    // Writes one unfiltered pixel row to BGRA pixels spaced `step` apart.
+    void convert_row(const png_header& header, const png_palette& palette, const uint8_t* row, const size_t count, uint8_t* out, const size_t step) {
+        const unsigned int channels = header.channels();
+        for (size_t x = 0; x < count; ++x, out += step * 4) {
+            uint16_t samples[4] = {};
+            for (unsigned int c = 0; c < channels; ++c)
+                samples[c] = sample(row, x * channels + c, header.bit_depth);
+
+            switch (header.color_type) {
+            case 0: {
+                const uint8_t gray = to_8bit(samples[0], header.bit_depth);
+                out[0] = out[1] = out[2] = gray;
+                out[3] = palette.has_key && samples[0] == palette.key[0] ? 0 : 255;
+                break;
+            }
+            case 2:
+                out[0] = to_8bit(samples[2], header.bit_depth);
+                out[1] = to_8bit(samples[1], header.bit_depth);
+                out[2] = to_8bit(samples[0], header.bit_depth);
+                out[3] = palette.has_key && samples[0] == palette.key[0] && samples[1] == palette.key[1] && samples[2] == palette.key[2] ? 0 : 255;
+                break;
+            case 3: {
+                const uint8_t* entry = palette.entries.data() + (samples[0] < palette.count ? samples[0] : 0) * 4;
+                out[0] = entry[2];
+                out[1] = entry[1];
+                out[2] = entry[0];
+                out[3] = entry[3];
+                break;
+            }
+            case 4: {
+                const uint8_t gray = to_8bit(samples[0], header.bit_depth);
+                out[0] = out[1] = out[2] = gray;
+                out[3] = to_8bit(samples[1], header.bit_depth);
+                break;
+            }
+            case 6:
+                out[0] = to_8bit(samples[2], header.bit_depth);
+                out[1] = to_8bit(samples[1], header.bit_depth);
+                out[2] = to_8bit(samples[0], header.bit_depth);
+                out[3] = to_8bit(samples[3], header.bit_depth);
+                break;
+            }
+        }
+    }
+
+    bool valid_format(const png_header& header) {
+        switch (header.color_type) {
+        case 0: return header.bit_depth == 1 || header.bit_depth == 2 || header.bit_depth == 4 || header.bit_depth == 8 || header.bit_depth == 16;
+        case 3: return header.bit_depth == 1 || header.bit_depth == 2 || header.bit_depth == 4 || header.bit_depth == 8;
+        case 2:
+        case 4:
+        case 6: return header.bit_depth == 8 || header.bit_depth == 16;
+        default: return false;
+        }
+    }
+}
+
+bool image::decode_png(const uint8_t* data, const size_t size, bitmap& out, std::string& error) {
+    png_header header;
+    png_palette palette;
+    std::vector<uint8_t> compressed;
+    bool seen_header = false, seen_end = false;
+
+    for (size_t position = 8; position < size && !seen_end;) {
+        if (size - position < 12) {
+            error = "truncated PNG chunk";
+            return false;
+        }
+        const uint32_t length = read_be32(data + position);
+        const uint8_t* type = data + position + 4;
+        const uint8_t* body = data + position + 8;
+        if (length > size - position - 12) {
+            error = "truncated PNG chunk";
+            return false;
+        }
+        if (image::crc32(type, length + 4) != read_be32(body + length)) {
+            error = "PNG chunk CRC mismatch";
+            return false;
+        }
+        position += 12 + static_cast<size_t>(length);
+
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            if (length != 13) {
+                error = "corrupt PNG header";
+                return false;
+            }
+            header.width = read_be32(body);
+            header.height = read_be32(body + 4);
+            header.bit_depth = body[8];
+            header.color_type = body[9];
+            header.interlace = body[12];
+            if (!valid_format(header) || body[10] != 0 || body[11] != 0 || header.interlace > 1) {
+                error = "unsupported PNG format";
+                return false;
+            }
+            if (header.width == 0 || header.height == 0 || static_cast<uint64_t>(header.width) * header.height > (uint64_t(1) << 28)) {
+                error = "unsupported PNG size";
+                return false;
+            }
+            seen_header = true;
+        }
+        else if (std::memcmp(type, "PLTE", 4) == 0) {
+            palette.count = std::min<size_t>(length / 3, 256);
+            for (size_t i = 0; i < palette.count; ++i) {
+                palette.entries[i * 4 + 0] = body[i * 3 + 0];
+                palette.entries[i * 4 + 1] = body[i * 3 + 1];
+                palette.entries[i * 4 + 2] = body[i * 3 + 2];
+                palette.entries[i * 4 + 3] = 255;
+            }
+        }
+        else if (std::memcmp(type, "tRNS", 4) == 0) {
+            if (header.color_type == 3) {
+                for (size_t i = 0; i < std::min<size_t>(length, 256); ++i)
+                    palette.entries[i * 4 + 3] = body[i];
+            }
+            else if (header.color_type == 0 && length >= 2) {
+                palette.has_key = true;
+                palette.key[0] = static_cast<uint16_t>((body[0] << 8) | body[1]);
+            }
+            else if (header.color_type == 2 && length >= 6) {
+                palette.has_key = true;
+                for (int c = 0; c < 3; ++c)
+                    palette.key[c] = static_cast<uint16_t>((body[c * 2] << 8) | body[c * 2 + 1]);
+            }
+        }
+        else if (std::memcmp(type, "IDAT", 4) == 0) {
+            compressed.insert(compressed.end(), body, body + length);
+        }
+        else if (std::memcmp(type, "IEND", 4) == 0) {
+            seen_end = true;
+        }
+        else if (!(type[0] & 0x20)) {
+            error = std::string("unknown critical PNG chunk ") + std::string(reinterpret_cast<const char*>(type), 4);
+            return false;
+        }
+    }
+
+    if (!seen_header || compressed.empty()) {
+        error = "PNG has no image data";
+        return false;
+    }
+    if (header.color_type == 3 && palette.count == 0) {
+        error = "PNG palette missing";
+        return false;
+    }
+
+    // Adam7 passes as (x0, y0, dx, dy); a non-interlaced image is one pass over everything.
+    static constexpr uint8_t adam7[7][4] = { { 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 } };
+    static constexpr uint8_t whole[1][4] = { { 0, 0, 1, 1 } };
+    const auto passes = header.interlace ? adam7 : whole;
+    const int pass_count = header.interlace ? 7 : 1;
+
+    // The filtered image data is exactly this long; inflating stops beyond it.
+    size_t expected = 0;
+    for (int pass = 0; pass < pass_count; ++pass) {
+        const size_t x0 = passes[pass][0], y0 = passes[pass][1], dx = passes[pass][2], dy = passes[pass][3];
+        if (x0 < header.width && y0 < header.height)
+            expected += (header.row_bytes((header.width - x0 + dx - 1) / dx) + 1) * ((header.height - y0 + dy - 1) / dy);
+    }
+
+    std::vector<uint8_t> raw;
+    if (!zlib_decompress(compressed.data(), compressed.size(), expected, raw, error)) {
+        error = "PNG: " + error;
+        return false;
+    }
+
+    const size_t bytes_per_pixel = std::max<size_t>(1, header.channels() * header.bit_depth / 8);
+    out.width = header.width;
+    out.height = header.height;
+    out.bgra.assign(static_cast<size_t>(header.width) * header.height * 4, 0);
+
+    size_t offset = 0;
+    for (int pass = 0; pass < pass_count; ++pass) {
+        const size_t x0 = passes[pass][0], y0 = passes[pass][1], dx = passes[pass][2], dy = passes[pass][3];
+        if (x0 >= header.width || y0 >= header.height)
+            continue;
+
+        const size_t pass_width = (header.width - x0 + dx - 1) / dx;
+        const size_t pass_height = (header.height - y0 + dy - 1) / dy;
+        const size_t row_bytes = header.row_bytes(pass_width);
+        const size_t pass_size = (row_bytes + 1) * pass_height;
+
+        if (raw.size() - offset < pass_size) {
+            error = "PNG image data too short";
+            return false;
+        }
+        uint8_t* pass_data = raw.data() + offset;
+        if (!unfilter(pass_data, row_bytes, pass_height, bytes_per_pixel)) {
+            error = "invalid PNG filter type";
+            return false;
+        }
+
+        for (size_t y = 0; y < pass_height; ++y) {
+            uint8_t* target = out.bgra.data() + ((y0 + y * dy) * header.width + x0) * 4;
+            convert_row(header, palette, pass_data + y * (row_bytes + 1) + 1, pass_width, target, dx);
+        }
+        offset += pass_size;
+    }
+    return true;
+}
@@ -0,0 +1,282 @@
+#include "fitness_kernels.h"
+#include <bit>
+#include <cstring>
+#include "../utilities/cpu_features.h"
+
+#if defined(GA_HC_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define GA_HC_SSE2 1
+#include <immintrin.h>
+#endif
+
+#if defined(GA_HC_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define GA_HC_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#else
+#define GA_HC_TARGET_AVX2
+#endif
+
+uint64_t kernels::sum_abs_diff_scalar(const uint8_t* a, const uint8_t* b, size_t size) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const int delta = static_cast<int>(a[i]) - static_cast<int>(b[i]);
+        total += static_cast<uint64_t>(delta < 0 ? -delta : delta);
+    }
+    return total;
+}
+
+static bool binary_bit(const uint8_t* pixel) {
+    return kernels::luma(pixel[0], pixel[1], pixel[2]) > kernels::binary_threshold;
+}
+
+static void bgra_to_luma_scalar(const uint8_t* bgra, uint8_t* luma_plane, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        luma_plane[i] = kernels::luma(bgra[i * 4 + 0], bgra[i * 4 + 1], bgra[i * 4 + 2]);
+    }
+}
+
+static void bgra_to_binary_mask_scalar(const uint8_t* bgra, uint64_t* mask, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        const uint64_t bit = uint64_t(1) << (i % 64);
+        if (binary_bit(bgra + i * 4))
+            mask[i / 64] |= bit;
+        else
+            mask[i / 64] &= ~bit;
+    }
+}
+
+static uint64_t count_bit_differences_scalar(const uint8_t* a, const uint8_t* b, size_t size) {
+    uint64_t differences = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t wa, wb;
+        std::memcpy(&wa, a + i, 8);
+        std::memcpy(&wb, b + i, 8);
+        differences += std::popcount(wa ^ wb);
+    }
+    for (; i < size; ++i)
+        differences += std::popcount(static_cast<uint8_t>(a[i] ^ b[i]));
+    return differences;
+}
+
+static void blend_bytes_scalar(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        const uint8_t select = static_cast<uint8_t>(static_cast<int8_t>(mask[i]) >> 7);
+        out[i] = static_cast<uint8_t>(a[i] ^ ((a[i] ^ b[i]) & select));
+    }
+}
+
+#ifdef GA_HC_SSE2
+static void blend_bytes_sse2(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t size) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const __m128i select = _mm_cmplt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + i)), zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_or_si128(_mm_and_si128(select, vb), _mm_andnot_si128(select, va)));
+    }
+    blend_bytes_scalar(a, b, mask, out, i, size);
+}
+
+GA_HC_TARGET_AVX2 static void blend_bytes_avx2(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t size) {
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i select = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_blendv_epi8(va, vb, select));
+    }
+    blend_bytes_sse2(a + i, b + i, mask + i, out + i, size - i);
+}
+
+// Same loop as the scalar version; compiled for popcnt so std::popcount is one instruction.
+GA_HC_TARGET_AVX2 static uint64_t count_bit_differences_avx2(const uint8_t* a, const uint8_t* b, size_t size) {
+    uint64_t differences = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t wa, wb;
+        std::memcpy(&wa, a + i, 8);
+        std::memcpy(&wb, b + i, 8);
+        differences += std::popcount(wa ^ wb);
+    }
+    for (; i < size; ++i)
+        differences += std::popcount(static_cast<uint8_t>(a[i] ^ b[i]));
+    return differences;
+}
+
+static uint64_t sum_abs_diff_sse2(const uint8_t* a, const uint8_t* b, size_t size) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+    }
+
+    alignas(16) uint64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + kernels::sum_abs_diff_scalar(a + i, b + i, size - i);
+}
+
+GA_HC_TARGET_AVX2 static uint64_t sum_abs_diff_avx2(const uint8_t* a, const uint8_t* b, size_t size) {
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 64 <= size; i += 64) {
+        const __m256i va0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i va1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 32));
+        const __m256i vb1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 32));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(va0, vb0));
+        acc1 = _mm256_add_epi64(acc1, _mm256_sad_epu8(va1, vb1));
+    }
+
+    for (; i + 32 <= size; i += 32) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_sad_epu8(va, vb));
+    }
+
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_abs_diff_sse2(a + i, b + i, size - i);
+}
+
+// Converts 32 BGRA pixels (128 bytes) to 32 luma bytes in pixel order.
+GA_HC_TARGET_AVX2 static __m256i luma32_avx2(const uint8_t* bgra) {
+    const __m256i weights = _mm256_set1_epi32(kernels::luma_weight_b | (kernels::luma_weight_g << 8) | (kernels::luma_weight_r << 16));
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i rounding = _mm256_set1_epi32(64);
+
+    __m256i quarters[4];
+    for (int q = 0; q < 4; ++q) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bgra + q * 32));
+        const __m256i pairs = _mm256_maddubs_epi16(pixels, weights);
+        const __m256i sums = _mm256_add_epi32(_mm256_madd_epi16(pairs, ones), rounding);
+        quarters[q] = _mm256_srli_epi32(sums, 7);
+    }
+
+    const __m256i words = _mm256_packus_epi16(_mm256_packus_epi32(quarters[0], quarters[1]), _mm256_packus_epi32(quarters[2], quarters[3]));
+    return _mm256_permutevar8x32_epi32(words, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+GA_HC_TARGET_AVX2 static uint32_t binary_bits32_avx2(const __m256i luma) {
+    const __m256i sign = _mm256_set1_epi8(static_cast<char>(0x80));
+    const __m256i threshold = _mm256_set1_epi8(static_cast<char>(kernels::binary_threshold ^ 0x80));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_xor_si256(luma, sign), threshold)));
+}
+
+GA_HC_TARGET_AVX2 static void bgra_to_luma_avx2(const uint8_t* bgra, uint8_t* luma_plane, size_t pixel_count) {
+    size_t i = 0;
+    for (; i + 32 <= pixel_count; i += 32) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(luma_plane + i), luma32_avx2(bgra + i * 4));
+    }
+    bgra_to_luma_scalar(bgra, luma_plane, i, pixel_count);
+}
+
+GA_HC_TARGET_AVX2 static void bgra_to_binary_mask_avx2(const uint8_t* bgra, uint64_t* mask, size_t pixel_count) {
+    size_t i = 0;
+    for (; i + 64 <= pixel_count; i += 64) {
+        const uint64_t low = binary_bits32_avx2(luma32_avx2(bgra + i * 4));
+        const uint64_t high = binary_bits32_avx2(luma32_avx2(bgra + (i + 32) * 4));
+        mask[i / 64] = low | (high << 32);
+    }
+    bgra_to_binary_mask_scalar(bgra, mask, i, pixel_count);
+}
+
+#endif
+
+struct dispatch_table {
+    kernels::isa active = kernels::isa::scalar;
+    uint64_t(*sum_abs_diff)(const uint8_t*, const uint8_t*, size_t) = kernels::sum_abs_diff_scalar;
+    void(*bgra_to_luma)(const uint8_t*, uint8_t*, size_t) = nullptr;
+    void(*bgra_to_binary_mask)(const uint8_t*, uint64_t*, size_t) = nullptr;
+    uint64_t(*count_bit_differences)(const uint8_t*, const uint8_t*, size_t) = count_bit_differences_scalar;
+    void(*blend_bytes)(const uint8_t*, const uint8_t*, const uint8_t*, uint8_t*, size_t) = nullptr;
+};
+
+static void bind(dispatch_table& table, kernels::isa value) {
+    table.active = value;
+    table.sum_abs_diff = kernels::sum_abs_diff_scalar;
+    table.bgra_to_luma = [](const uint8_t* bgra, uint8_t* luma_plane, size_t pixel_count) { bgra_to_luma_scalar(bgra, luma_plane, 0, pixel_count); };
+    table.bgra_to_binary_mask = [](const uint8_t* bgra, uint64_t* mask, size_t pixel_count) { bgra_to_binary_mask_scalar(bgra, mask, 0, pixel_count); };
+    table.count_bit_differences = count_bit_differences_scalar;
+    table.blend_bytes = [](const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t size) { blend_bytes_scalar(a, b, mask, out, 0, size); };
+
+    switch (value) {
+#ifdef GA_HC_SSE2
+    case kernels::isa::avx2:
+        table.sum_abs_diff = sum_abs_diff_avx2;
+        table.bgra_to_luma = bgra_to_luma_avx2;
+        table.bgra_to_binary_mask = bgra_to_binary_mask_avx2;
+        table.count_bit_differences = count_bit_differences_avx2;
+        table.blend_bytes = blend_bytes_avx2;
+        break;
+    case kernels::isa::sse2:
+        table.sum_abs_diff = sum_abs_diff_sse2;
+        table.blend_bytes = blend_bytes_sse2;
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+static dispatch_table& dispatch() {
+    static dispatch_table table = [] {
+        dispatch_table result;
+        bind(result, kernels::best_supported_isa());
+        return result;
+    }();
+    return table;
+}
+
+uint64_t kernels::sum_abs_diff(const uint8_t* a, const uint8_t* b, size_t size) {
+    return dispatch().sum_abs_diff(a, b, size);
+}
+
+void kernels::bgra_to_luma(const uint8_t* bgra, uint8_t* luma_plane, size_t pixel_count) {
+    dispatch().bgra_to_luma(bgra, luma_plane, pixel_count);
+}
+
+void kernels::bgra_to_binary_mask(const uint8_t* bgra, uint64_t* mask, size_t pixel_count) {
+    dispatch().bgra_to_binary_mask(bgra, mask, pixel_count);
+}
+
+uint64_t kernels::count_bit_differences(const uint8_t* a, const uint8_t* b, size_t size) {
+    return dispatch().count_bit_differences(a, b, size);
+}
+
+void kernels::blend_bytes(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t size) {
+    dispatch().blend_bytes(a, b, mask, out, size);
+}
+
+kernels::isa kernels::best_supported_isa() {
+#ifdef GA_HC_SSE2
+    return cpu_features::has_avx2() ? isa::avx2 : isa::sse2;
+#else
+    return isa::scalar;
+#endif
+}
+
+kernels::isa kernels::active_isa() {
+    return dispatch().active;
+}
+
+void kernels::select_isa(isa requested) {
+    const isa supported = best_supported_isa();
+    bind(dispatch(), static_cast<int>(requested) > static_cast<int>(supported) ? supported : requested);
+}
+
+const char* kernels::isa_name(isa value) {
+    switch (value) {
+    case isa::avx2: return "avx2";
+    case isa::sse2: return "sse2";
+    default: return "scalar";
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace kernels {
+    enum class isa {
+        scalar,
+        sse2,
+        avx2
+    };
+
+    // Sum of |a[i] - b[i]| over size bytes. Dispatched once at startup to the
+    // widest instruction set the CPU supports; every path returns the exact sum.
+    uint64_t sum_abs_diff(const uint8_t* a, const uint8_t* b, size_t size);
+
+    uint64_t sum_abs_diff_scalar(const uint8_t* a, const uint8_t* b, size_t size);
+
+    // BT.601 luma in 7-bit fixed point (0.114 B + 0.587 G + 0.299 R); the
+    // weights sum to 128 so a pixel with B == G == R maps back to itself.
+    inline constexpr int luma_weight_b = 15;
+    inline constexpr int luma_weight_g = 75;
+    inline constexpr int luma_weight_r = 38;
+    inline constexpr uint8_t binary_threshold = 128;
+
+    constexpr uint8_t luma(const uint8_t b, const uint8_t g, const uint8_t r) {
+        return static_cast<uint8_t>((luma_weight_b * b + luma_weight_g * g + luma_weight_r * r + 64) >> 7);
+    }
+
+    constexpr size_t binary_mask_words(const size_t pixel_count) {
+        return (pixel_count + 63) / 64;
+    }
+
+    // Target preprocessing: an 8-bit luma plane and a packed bitmask (bit i of
+    // word i / 64 is set when pixel i is brighter than binary_threshold).
+    void bgra_to_luma(const uint8_t* bgra, uint8_t* luma_plane, size_t pixel_count);
+    void bgra_to_binary_mask(const uint8_t* bgra, uint64_t* mask, size_t pixel_count);
+
+    // Number of differing bits between two packed bit strings of size bytes.
+    uint64_t count_bit_differences(const uint8_t* a, const uint8_t* b, size_t size);
+
+    // out[i] = (mask[i] & 0x80) ? b[i] : a[i]; used by the crossover operators.
+    // out may alias a or b.
+    void blend_bytes(const uint8_t* a, const uint8_t* b, const uint8_t* mask, uint8_t* out, size_t size);
+
+    isa best_supported_isa();
+    isa active_isa();
+    // Forces a narrower path (e.g. for verification); requests above the
+    // supported instruction set are clamped. Not thread safe, call before starting workers.
+    void select_isa(isa requested);
+    const char* isa_name(isa value);
+}
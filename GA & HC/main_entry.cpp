@@ -1,14 +1,32 @@
-#include "genetic/genetic.h"
-#include "hill_climbing/hill_climbing.h"
+#include <string>
+#include "image/image_loader.h"
+#include "overlay/overlay.h"
+#include "utilities/throttle.h"
+
+int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR command_line, int) {
+    // An optional target image path on the command line replaces the built-in image.
+    std::string target_path = command_line ? command_line : "";
+    if (target_path.size() >= 2 && target_path.front() == '"' && target_path.back() == '"')
+        target_path = target_path.substr(1, target_path.size() - 2);
+    if (!target_path.empty()) {
+        image::bitmap loaded;
+        std::string error;
+        if (!image::load(target_path.c_str(), loaded, error)) {
+            LI_FN(MessageBoxA).safe()(NULL, error.c_str(), encrypt("ERROR"), MB_ICONERROR);
+            return FALSE;
+        }
+        globals::target = globals::make_target(loaded.width, loaded.height, loaded.bgra.data());
+    }
 
-int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
     if (!renderer::initialize()) {
         LI_FN(MessageBoxA).safe()(NULL, encrypt("Failed to initialize renderer!"), encrypt("ERROR"), MB_ICONERROR);
         return FALSE;
     }
 
-    SetPriorityClass(GetCurrentProcess(), REALTIME_PRIORITY_CLASS);
-	SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+    // Workers run below normal priority so the desktop stays responsive; the
+    // overlay changes their CPU budget at runtime.
+    throttle::priority.store(platform::priority::low);
+    platform::set_process_priority(platform::priority::low);
 
     D2D1_BITMAP_PROPERTIES props = {
     { DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED },
@@ -16,24 +34,24 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
     };
 
     HRESULT hr = renderer::d2d1::render_target->CreateBitmap(
-        D2D1::SizeU(globals::image_width, globals::image_height), nullptr, 0, &props, &globals::current_color_bitmap);
+        D2D1::SizeU(globals::target.width, globals::target.height), nullptr, 0, &props, &globals::current_color_bitmap);
     ASSERT(SUCCEEDED(hr), encrypt("Failed to create bitmap."));
 
     hr = renderer::d2d1::render_target->CreateBitmap(
-        D2D1::SizeU(globals::image_width, globals::image_height), nullptr, 0, &props, &globals::current_gray_scale_bitmap);
+        D2D1::SizeU(globals::target.width, globals::target.height), nullptr, 0, &props, &globals::current_gray_scale_bitmap);
     ASSERT(SUCCEEDED(hr), encrypt("Failed to create bitmap."));
 
     hr = renderer::d2d1::render_target->CreateBitmap(
-        D2D1::SizeU(globals::image_width, globals::image_height), nullptr, 0, &props, &globals::current_binary_bitmap);
+        D2D1::SizeU(globals::target.width, globals::target.height), nullptr, 0, &props, &globals::current_binary_bitmap);
     ASSERT(SUCCEEDED(hr), encrypt("Failed to create bitmap."));
 
     hr = renderer::d2d1::render_target->CreateBitmap(
-        D2D1::SizeU(globals::image_width, globals::image_height),
-        globals::image_byte_code_array, globals::image_width * 4, &props, &globals::goal_bitmap);
+        D2D1::SizeU(globals::target.width, globals::target.height),
+        globals::target.bgra.data(), globals::target.width * 4, &props, &globals::goal_bitmap);
     ASSERT(SUCCEEDED(hr), encrypt("Failed to create goal bitmap."));
 
-	genetic_algorithm::initialize();
-    hill_climbing::initialize();
+    if (!overlay::run_genetic_algorithm())
+        overlay::run_hill_climbing();
 
     globals::goal_bitmap->Release();
     globals::current_color_bitmap->Release();
@@ -0,0 +1,134 @@
+#include "overlay.h"
+#include <atomic>
+#include <string>
+#include <vector>
+#include "../genetic/genetic.h"
+#include "../hill_climbing/hill_climbing.h"
+#include "../utilities/encoding.h"
+#include "../utilities/throttle.h"
+
+struct mode_view {
+    const wchar_t* label;
+    ID2D1Bitmap* bitmap;
+    encoding::format format;
+    triple_buffer<individual>& best;
+    std::atomic<unsigned int>& generation;
+};
+
+// Takes the worker's latest published best and uploads it, if it changed.
+static void upload_best(const mode_view& mode) {
+    static std::vector<uint8_t> pixels;
+    pixels.resize(globals::target.pixel_count() * 4);
+
+    if (!mode.best.acquire())
+        return;
+    const individual& best = mode.best.front();
+    if (!best.genome.empty()) {
+        encoding::to_bgra(mode.format, best.genome.data(), pixels.data(), globals::target.pixel_count());
+        mode.bitmap->CopyFromMemory(nullptr, pixels.data(), globals::target.width * 4);
+    }
+}
+
+static void render_mode(IDWriteTextFormat* font, const mode_view& mode, const vector2& position) {
+    if (!mode.generation.load())
+        return;
+
+    std::wstring text = std::wstring(mode.label) + L" Gen - Fitness: " + std::to_wstring(mode.best.front().fitness) +
+        L" | Gen: " + std::to_wstring(mode.generation.load());
+    renderer::items::render_text(font, position + vector2(0.f, overlay::text_offset_y), text.c_str(), COLOR_WHITE);
+    renderer::items::render_bitmap(mode.bitmap, position, vector2(position.x + overlay::bitmap_size().x, position.y + overlay::bitmap_size().y), 1.f);
+}
+
+// Page Up / Page Down change the workers' CPU budget in 10% steps.
+static void handle_throttle_keys() {
+    static bool up_was_down = false;
+    static bool down_was_down = false;
+
+    const bool up = GetAsyncKeyState(VK_PRIOR) & 0x8000;
+    const bool down = GetAsyncKeyState(VK_NEXT) & 0x8000;
+    if (up && !up_was_down)
+        throttle::set_utilization(throttle::utilization.load() + 0.1f);
+    if (down && !down_was_down)
+        throttle::set_utilization(throttle::utilization.load() - 0.1f);
+    up_was_down = up;
+    down_was_down = down;
+}
+
+static void render_throttle(IDWriteTextFormat* font, const vector2& position) {
+    const std::wstring text = L"CPU budget: " + std::to_wstring(static_cast<int>(throttle::utilization.load() * 100.f + 0.5f)) +
+        L"% (PgUp/PgDn) | Throttled: " + std::to_wstring(static_cast<long long>(throttle::throttled_seconds())) + L"s";
+    renderer::items::render_text(font, position, text.c_str(), COLOR_WHITE);
+}
+
+// Draws until every worker has finished or the user quits; returns whether
+// the user quit (End key or WM_QUIT).
+template <typename UpdateStopFunc>
+static bool render_loop(const mode_view (&modes)[3], UpdateStopFunc update_stop_conditions) {
+    MSG msg;
+    while (true) {
+        if (LI_FN(PeekMessageW)(&msg, renderer::overlay::hwnd, 0, 0, PM_REMOVE)) {
+            if (msg.message == WM_QUIT)
+                return true;
+            LI_FN(TranslateMessage)(&msg);
+            LI_FN(DispatchMessageW)(&msg);
+        }
+
+        for (const auto& mode : modes)
+            upload_best(mode);
+
+        renderer::d2d1::render_target->BeginDraw();
+        renderer::d2d1::render_target->Clear();
+
+        auto font = GET_FONT(encrypt("verdana"), 13.f, DWRITE_FONT_WEIGHT_BOLD);
+
+        vector2 goal_pos(overlay::spacing_x, overlay::top_y);
+        renderer::items::render_text(font, goal_pos + vector2(0.f, overlay::text_offset_y), L"Goal", COLOR_WHITE);
+        renderer::items::render_bitmap(globals::goal_bitmap, goal_pos, goal_pos + overlay::bitmap_size(), 1.f);
+
+        for (size_t i = 0; i < 3; ++i) {
+            vector2 mode_pos(goal_pos.x + (i + 1) * (globals::target.width + overlay::spacing_x * 5.f), overlay::top_y);
+            render_mode(font, modes[i], mode_pos);
+        }
+        render_throttle(font, vector2(overlay::spacing_x, overlay::top_y + overlay::bitmap_size().y + 20.f));
+
+        renderer::d2d1::render_target->EndDraw();
+
+        handle_throttle_keys();
+        if (GetAsyncKeyState(VK_END) & 0x8000)
+            return true;
+        if (update_stop_conditions())
+            return false;
+    }
+}
+
+bool overlay::run_genetic_algorithm() {
+    using namespace genetic_algorithm;
+
+    initialize();
+    start();
+
+    const mode_view modes[3] = {
+        { L"Color", globals::current_color_bitmap, encoding::format::bgra, color_best_snapshot, color_generation },
+        { L"Gray", globals::current_gray_scale_bitmap, encoding::format::luma, gray_scale_best_snapshot, gray_scale_generation },
+        { L"Binary", globals::current_binary_bitmap, encoding::format::bits, binary_best_snapshot, binary_generation },
+    };
+    const bool quit = render_loop(modes, update_stop_conditions);
+    stop();
+    return quit;
+}
+
+bool overlay::run_hill_climbing() {
+    using namespace hill_climbing;
+
+    initialize();
+    start();
+
+    const mode_view modes[3] = {
+        { L"Color", globals::current_color_bitmap, encoding::format::bgra, color_best_snapshot, color_generation },
+        { L"Gray", globals::current_gray_scale_bitmap, encoding::format::luma, gray_scale_best_snapshot, gray_scale_generation },
+        { L"Binary", globals::current_binary_bitmap, encoding::format::bits, binary_best_snapshot, binary_generation },
+    };
+    const bool quit = render_loop(modes, update_stop_conditions);
+    stop();
+    return quit;
+}
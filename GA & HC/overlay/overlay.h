@@ -0,0 +1,17 @@
+#pragma once
+
+#include "../globals.h"
+
+namespace overlay {
+    inline constexpr float spacing_x = 75.f;
+    inline constexpr float top_y = 100.f;
+    inline constexpr float text_offset_y = -25.f;
+    inline vector2 bitmap_size() {
+        return vector2(globals::target.width * 5.f, globals::target.height * 5.f);
+    }
+
+    // Each runs its workers until they finish or the user quits, then stops
+    // and joins them; returns whether the user quit.
+    bool run_genetic_algorithm();
+    bool run_hill_climbing();
+}
@@ -0,0 +1,130 @@
+#include "telemetry.h"
+#include <array>
+#include <cmath>
+#include <cstring>
+#include "../utilities/cancellation.h"
+
+// How often the writer thread empties the queue.
+static constexpr std::chrono::milliseconds drain_interval(5);
+
+bool telemetry::log::open(const std::string& path, std::string& error) {
+    close();
+
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "cannot write '" + path + "'";
+        return false;
+    }
+    const file_header header;
+    if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+        std::fclose(file);
+        file = nullptr;
+        error = "cannot write '" + path + "'";
+        return false;
+    }
+
+    queue.reset(queue_capacity);
+    dropped.store(0);
+    written.store(0);
+    start = std::chrono::steady_clock::now();
+    writer = std::jthread([this](std::stop_token stop) {
+        cancellation::sleeper sleeper;
+        while (!stop.stop_requested()) {
+            drain();
+            sleeper.sleep_for(stop, drain_interval);
+        }
+    });
+    return true;
+}
+
+void telemetry::log::close() {
+    if (!file)
+        return;
+
+    if (writer.joinable()) {
+        writer.request_stop();
+        writer.join();
+    }
+    drain();
+    std::fclose(file);
+    file = nullptr;
+}
+
+void telemetry::log::drain() {
+    std::array<sample, 256> batch;
+    size_t count = 0;
+    uint64_t total = 0;
+    const auto flush = [&] {
+        std::fwrite(batch.data(), sizeof(sample), count, file);
+        total += count;
+        count = 0;
+    };
+
+    while (queue.try_pop(batch[count])) {
+        if (++count == batch.size())
+            flush();
+    }
+    if (count)
+        flush();
+    if (total) {
+        std::fflush(file);
+        written.fetch_add(total, std::memory_order_relaxed);
+    }
+}
+
+const char* telemetry::algorithm_name(const algorithm value) {
+    return value == algorithm::genetic ? "ga" : "hc";
+}
+
+static const char* format_name(const uint8_t value) {
+    switch (static_cast<encoding::format>(value)) {
+    case encoding::format::bgra: return "color";
+    case encoding::format::luma: return "gray";
+    case encoding::format::bits: return "binary";
+    }
+    return "unknown";
+}
+
+bool telemetry::convert_to_csv(const char* path, std::FILE* out, std::string& error) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        error = std::string("cannot open '") + path + "'";
+        return false;
+    }
+
+    file_header header;
+    const file_header expected;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0) {
+        std::fclose(file);
+        error = std::string("'") + path + "' is not a telemetry log";
+        return false;
+    }
+    if (header.version != expected.version || header.sample_size != expected.sample_size) {
+        std::fclose(file);
+        error = std::string("'") + path + "' has unsupported telemetry version " + std::to_string(header.version);
+        return false;
+    }
+
+    // Fields not applicable to a sample's algorithm are left empty.
+    const auto field = [out](const float value, const char* format) {
+        std::fputc(',', out);
+        if (!std::isnan(value))
+            std::fprintf(out, format, value);
+    };
+
+    std::fprintf(out, "seconds,algorithm,mode,worker,step,best_fitness,mean_fitness,worst_fitness,acceptance,diversity,evaluations_per_second\n");
+    sample value;
+    while (std::fread(&value, sizeof(value), 1, file) == 1) {
+        std::fprintf(out, "%.6f,%s,%s,%u,%u", static_cast<double>(value.nanoseconds) * 1e-9, algorithm_name(value.kind), format_name(value.format),
+            static_cast<unsigned int>(value.worker), static_cast<unsigned int>(value.step));
+        field(value.best_fitness, "%.6f");
+        field(value.mean_fitness, "%.6f");
+        field(value.worst_fitness, "%.6f");
+        field(value.acceptance, "%.4f");
+        field(value.diversity, "%.4f");
+        field(value.evaluations_per_second, "%.0f");
+        std::fputc('\n', out);
+    }
+    std::fclose(file);
+    return true;
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <span>
+#include <string>
+#include <thread>
+#include "../utilities/encoding.h"
+#include "../utilities/mpsc_queue.h"
+
+// Convergence telemetry: workers record a sample every GA generation and
+// every `iteration_interval` hill-climbing iterations into a lock-free queue,
+// and a writer thread appends them to a compact binary log. A full queue
+// drops the sample rather than making the worker wait. convert_to_csv turns
+// a log into CSV.
+namespace telemetry {
+    enum class algorithm : uint8_t {
+        genetic,
+        hill_climbing
+    };
+
+    // Fixed-size record, written to the log as is.
+    struct sample {
+        // Since the log was opened.
+        uint64_t nanoseconds = 0;
+        // GA generation or hill-climbing iteration.
+        uint32_t step = 0;
+        algorithm kind = algorithm::genetic;
+        // encoding::format.
+        uint8_t format = 0;
+        // Island or climber index.
+        uint16_t worker = 0;
+        float best_fitness = 0.f;
+        // Of the island's population; not_applicable for hill climbing.
+        float mean_fitness = 0.f;
+        float worst_fitness = 0.f;
+        // GA: share of the generation fitter than the previous generation's
+        // mean, not_applicable for the first generation. Hill climbing: share
+        // of steps since the last sample that were accepted.
+        float acceptance = 0.f;
+        // Mean distance to the best individual, 0 to 1, over sampled genes.
+        float diversity = 0.f;
+        float evaluations_per_second = 0.f;
+    };
+    static_assert(sizeof(sample) == 40, "the sample layout is part of the log format");
+
+    // Start of every log, followed by samples.
+    struct file_header {
+        char magic[8] = { 'G', 'A', 'H', 'C', 'T', 'E', 'L', 'M' };
+        uint32_t version = 1;
+        uint32_t sample_size = sizeof(sample);
+    };
+
+    // Marks a field that has no meaning for the sample's algorithm; written
+    // as an empty CSV field.
+    inline constexpr float not_applicable = std::numeric_limits<float>::quiet_NaN();
+
+    inline constexpr size_t queue_capacity = 1U << 14;
+
+    // Hill-climbing iterations between samples.
+    inline unsigned int iteration_interval = 1000U;
+
+    struct log {
+        ~log() { close(); }
+
+        bool open(const std::string& path, std::string& error);
+        // Writes what is queued and closes the file; not thread safe with push.
+        void close();
+
+        // Never blocks; false if the sample was dropped.
+        bool push(const sample& value) {
+            if (queue.try_push(value))
+                return true;
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint64_t dropped_samples() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+        uint64_t written_samples() const {
+            return written.load(std::memory_order_relaxed);
+        }
+
+        std::chrono::steady_clock::time_point start;
+
+    private:
+        void drain();
+
+        mpsc_queue<sample> queue;
+        std::FILE* file = nullptr;
+        std::jthread writer;
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<uint64_t> written{ 0 };
+    };
+
+    // Log the mode workers record into, nullptr when off. Set while no
+    // workers run; runs started through genetic_algorithm::run and
+    // hill_climbing::run do not record.
+    inline log* output = nullptr;
+
+    // Mean per-gene distance between two genomes of the same format, 0 to
+    // 1, over at most `genes` evenly spread positions.
+    inline float distance(const encoding::format format, std::span<const uint8_t> a, std::span<const uint8_t> b, const size_t genes = 64) {
+        const size_t size = std::min(a.size(), b.size());
+        if (!size)
+            return 0.f;
+
+        const size_t stride = std::max<size_t>(size / genes, 1);
+        uint64_t sum = 0;
+        size_t count = 0;
+        for (size_t i = stride / 2; i < size; i += stride, ++count) {
+            if (format == encoding::format::bits)
+                sum += std::popcount(static_cast<unsigned int>(a[i] ^ b[i]));
+            else
+                sum += a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        }
+        const double scale = format == encoding::format::bits ? 8.0 : 255.0;
+        return count ? static_cast<float>(static_cast<double>(sum) / (scale * static_cast<double>(count))) : 0.f;
+    }
+
+    // One worker's samples; turns evaluation counts into rates.
+    struct recorder {
+        recorder(log* output, const algorithm kind, const encoding::format format, const size_t worker)
+            : output(output), kind(kind), format(format), worker(static_cast<uint16_t>(worker)), last_time(std::chrono::steady_clock::now()) {}
+
+        explicit operator bool() const {
+            return output != nullptr;
+        }
+
+        // evaluations counts every fitness evaluation since the worker started.
+        void record(const unsigned int step, const float best, const float mean, const float worst, const float acceptance, const float diversity, const uint64_t evaluations) {
+            const auto now = std::chrono::steady_clock::now();
+            const double seconds = std::chrono::duration<double>(now - last_time).count();
+
+            sample value;
+            value.nanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - output->start).count());
+            value.step = step;
+            value.kind = kind;
+            value.format = static_cast<uint8_t>(format);
+            value.worker = worker;
+            value.best_fitness = best;
+            value.mean_fitness = mean;
+            value.worst_fitness = worst;
+            value.acceptance = acceptance;
+            value.diversity = diversity;
+            value.evaluations_per_second = seconds > 0.0 ? static_cast<float>(static_cast<double>(evaluations - last_evaluations) / seconds) : 0.f;
+            output->push(value);
+
+            last_time = now;
+            last_evaluations = evaluations;
+        }
+
+    private:
+        log* output;
+        algorithm kind;
+        encoding::format format;
+        uint16_t worker;
+        std::chrono::steady_clock::time_point last_time;
+        uint64_t last_evaluations = 0;
+    };
+
+    const char* algorithm_name(algorithm value);
+
+    // Writes the samples of the log at path as CSV to out.
+    bool convert_to_csv(const char* path, std::FILE* out, std::string& error);
+}
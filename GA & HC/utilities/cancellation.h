@@ -0,0 +1,54 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+
+// Cooperative cancellation on top of std::stop_token: waits that end as soon
+// as a stop is requested, and an event for threads waiting on workers.
+namespace cancellation {
+    // Reusable interruptible sleep; one per thread that sleeps. Built on
+    // std::condition_variable, which unlike condition_variable_any does not
+    // allocate, so workers stay allocation-free.
+    struct sleeper {
+        std::mutex mtx;
+        std::condition_variable cv;
+
+        // Returns false if the sleep was cut short by a stop request.
+        template <typename Rep, typename Period>
+        bool sleep_for(const std::stop_token& stop, const std::chrono::duration<Rep, Period>& duration) {
+            // Registered before locking: it runs right here if stop is already requested.
+            const std::stop_callback wake(stop, [this] {
+                {
+                    std::lock_guard<std::mutex> lock(mtx);
+                }
+                cv.notify_all();
+            });
+            std::unique_lock<std::mutex> lock(mtx);
+            return !cv.wait_for(lock, duration, [&stop] { return stop.stop_requested(); });
+        }
+    };
+
+    // Notified whenever a worker finishes, so waiters can re-check their
+    // condition instead of polling.
+    struct event {
+        std::mutex mtx;
+        std::condition_variable cv;
+
+        void notify() {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+            }
+            cv.notify_all();
+        }
+
+        // Returns predicate() once it holds or the deadline passes.
+        template <typename Clock, typename Duration, typename Predicate>
+        bool wait_until(const std::chrono::time_point<Clock, Duration>& deadline, Predicate predicate) {
+            std::unique_lock<std::mutex> lock(mtx);
+            return cv.wait_until(lock, deadline, predicate);
+        }
+    };
+
+    inline event worker_finished;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define GA_HC_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace cpu_features {
+#ifdef GA_HC_X86
+    namespace detail {
+        struct flags {
+            bool avx2 = false;
+        };
+
+        inline flags detect() {
+            flags result;
+#if defined(_MSC_VER)
+            int info[4] = {};
+            __cpuid(info, 0);
+            const int max_leaf = info[0];
+
+            __cpuid(info, 1);
+            const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+
+            if (max_leaf >= 7) {
+                __cpuidex(info, 7, 0);
+                result.avx2 = avx && os_saves_ymm && (info[1] & (1 << 5)) != 0;
+            }
+#else
+            __builtin_cpu_init();
+            result.avx2 = __builtin_cpu_supports("avx2");
+#endif
+            return result;
+        }
+
+        inline const flags& get() {
+            static const flags cached = detect();
+            return cached;
+        }
+    }
+
+    inline bool has_avx2() { return detail::get().avx2; }
+#else
+    inline bool has_avx2() { return false; }
+#endif
+}
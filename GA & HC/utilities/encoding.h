@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../kernels/fitness_kernels.h"
+
+// Genome layouts. Color genomes are BGRA pixels; gray genomes store one luma
+// byte per pixel and binary genomes one bit per pixel (bit i is bit i % 8 of
+// byte i / 8, padded to whole 64-bit words, which on little-endian targets
+// is the layout of globals::target_image::binary_mask). Only the display expands
+// them back to BGRA.
+namespace encoding {
+    enum class format {
+        bgra,
+        luma,
+        bits
+    };
+
+    constexpr size_t genome_size(const format value, const size_t pixel_count) {
+        switch (value) {
+        case format::luma: return pixel_count;
+        case format::bits: return kernels::binary_mask_words(pixel_count) * 8;
+        default: return pixel_count * 4;
+        }
+    }
+
+    inline bool get_bit(const uint8_t* bits, const size_t index) {
+        return (bits[index / 8] >> (index % 8)) & 1;
+    }
+
+    inline void flip_bit(uint8_t* bits, const size_t index) {
+        bits[index / 8] ^= static_cast<uint8_t>(1U << (index % 8));
+    }
+
+    // Clears the padding bits after the last pixel.
+    inline void clear_padding(uint8_t* bits, const size_t pixel_count) {
+        const size_t size = genome_size(format::bits, pixel_count);
+        if (pixel_count % 8)
+            bits[pixel_count / 8] &= static_cast<uint8_t>((1U << (pixel_count % 8)) - 1);
+        const size_t used = (pixel_count + 7) / 8;
+        std::memset(bits + used, 0, size - used);
+    }
+
+    // Writes pixel_count opaque BGRA pixels for display.
+    inline void to_bgra(const format value, const uint8_t* genome, uint8_t* bgra, const size_t pixel_count) {
+        if (value == format::bgra) {
+            std::memcpy(bgra, genome, pixel_count * 4);
+            return;
+        }
+
+        for (size_t i = 0; i < pixel_count; ++i) {
+            const uint8_t level = value == format::luma ? genome[i] : (get_bit(genome, i) ? 255 : 0);
+            bgra[i * 4 + 0] = level;
+            bgra[i * 4 + 1] = level;
+            bgra[i * 4 + 2] = level;
+            bgra[i * 4 + 3] = 255;
+        }
+    }
+}
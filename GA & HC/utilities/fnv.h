@@ -1,6 +1,8 @@
 #pragma once
 #include <iostream>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 
 namespace hash {
 	template <typename S> struct fnv1;
@@ -10,4 +12,11 @@ namespace hash {
 			return (aString[0] == '\0') ? val : hash(&aString[1], (val * 0x01000193) ^ uint32_t(aString[0]));
 		}
 	};
+
+	inline uint64_t fnv1a64(const void* data, const size_t size, uint64_t val = 0xCBF29CE484222325ULL) {
+		const auto* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; ++i)
+			val = (val ^ bytes[i]) * 0x100000001B3ULL;
+		return val;
+	}
 }
@@ -1,7 +1,18 @@
 #pragma once
+#include <cstdint>
 #include <vector>
 
 struct individual {
     std::vector<uint8_t> genome;
     float fitness = -1e9f;
-};
\ No newline at end of file
+    uint64_t error = 0;
+};
+
+// One entry per mutated gene: a byte for color and gray genomes, a bit
+// (old_value 0 or 1, index in pixels) for binary genomes.
+struct gene_change {
+    uint32_t index;
+    uint8_t old_value;
+};
+
+using mutation_log = std::vector<gene_change>;
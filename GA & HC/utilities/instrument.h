@@ -0,0 +1,298 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#if defined(GA_HC_INSTRUMENT) && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define GA_HC_INSTRUMENT_RDTSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+// Where the workers spend their time. Built with GA_HC_INSTRUMENT (CMake
+// option of the same name) GA_HC_TIME(phase) adds the duration of the
+// enclosing scope and GA_HC_COUNT(event, n) a count to counters owned by the
+// calling thread: every thread has its own cache-line aligned block that only
+// it writes, so recording is two time stamp reads and plain stores. collect()
+// sums the blocks at any time. Without GA_HC_INSTRUMENT both macros expand to
+// nothing and collect() returns zeros.
+namespace instrument {
+    enum class phase {
+        fitness,
+        mutation,
+        undo,
+        selection,
+        crossover,
+        copy,
+        publish,
+        migration,
+        restart,
+        throttle,
+        count
+    };
+
+    enum class event {
+        evaluations,
+        improvements,
+        restarts,
+        migrants,
+        count
+    };
+
+    inline constexpr size_t phase_count = static_cast<size_t>(phase::count);
+    inline constexpr size_t event_count = static_cast<size_t>(event::count);
+
+#if defined(GA_HC_INSTRUMENT)
+    inline constexpr bool enabled = true;
+#else
+    inline constexpr bool enabled = false;
+#endif
+
+    inline const char* phase_name(const phase value) {
+        switch (value) {
+        case phase::fitness: return "fitness";
+        case phase::mutation: return "mutation";
+        case phase::undo: return "undo";
+        case phase::selection: return "selection";
+        case phase::crossover: return "crossover";
+        case phase::copy: return "copy";
+        case phase::publish: return "publish";
+        case phase::migration: return "migration";
+        case phase::restart: return "restart";
+        case phase::throttle: return "throttle";
+        case phase::count: break;
+        }
+        return "unknown";
+    }
+
+    inline const char* event_name(const event value) {
+        switch (value) {
+        case event::evaluations: return "evaluations";
+        case event::improvements: return "improvements";
+        case event::restarts: return "restarts";
+        case event::migrants: return "migrants";
+        case event::count: break;
+        }
+        return "unknown";
+    }
+
+    struct totals {
+        std::array<uint64_t, phase_count> nanoseconds{};
+        std::array<uint64_t, phase_count> calls{};
+        std::array<uint64_t, event_count> events{};
+
+        uint64_t timed_nanoseconds() const {
+            uint64_t sum = 0;
+            for (const uint64_t value : nanoseconds)
+                sum += value;
+            return sum;
+        }
+    };
+
+    struct snapshot {
+        // Wall time since the counters were last reset.
+        double seconds = 0.0;
+        totals all;
+        // One entry per thread block that recorded anything.
+        std::vector<totals> threads;
+    };
+
+#if defined(GA_HC_INSTRUMENT)
+    // Blocks handed out to threads; threads beyond this share the last one.
+    inline constexpr size_t max_threads = 256;
+
+    struct alignas(64) thread_counters {
+        std::atomic<bool> claimed{ false };
+        std::array<std::atomic<uint64_t>, phase_count> ticks{};
+        std::array<std::atomic<uint64_t>, phase_count> calls{};
+        std::array<std::atomic<uint64_t>, event_count> events{};
+    };
+
+    inline std::array<thread_counters, max_threads> blocks;
+
+    inline uint64_t now() {
+#if defined(GA_HC_INSTRUMENT_RDTSC)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Ticks of now() against the steady clock at the last reset; the ratio
+    // since then converts ticks to nanoseconds.
+    struct clock_epoch {
+        uint64_t ticks = now();
+        std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
+    };
+    inline clock_epoch epoch;
+
+    // The calling thread's block, released for another thread when it exits.
+    struct thread_block {
+        thread_counters* counters = nullptr;
+        bool shared = false;
+
+        ~thread_block() {
+            if (counters && !shared)
+                counters->claimed.store(false, std::memory_order_release);
+        }
+
+        thread_counters& get() {
+            if (!counters)
+                claim();
+            return *counters;
+        }
+
+        void claim() {
+            for (size_t i = 0; i + 1 < max_threads; ++i) {
+                bool idle = false;
+                if (blocks[i].claimed.compare_exchange_strong(idle, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                    counters = &blocks[i];
+                    return;
+                }
+            }
+            counters = &blocks[max_threads - 1];
+            shared = true;
+        }
+
+        void add(std::atomic<uint64_t>& counter, const uint64_t value) const {
+            if (shared)
+                counter.fetch_add(value, std::memory_order_relaxed);
+            else
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+    };
+
+    inline thread_local thread_block own;
+
+    inline void record(const phase which, const uint64_t ticks) {
+        thread_counters& counters = own.get();
+        own.add(counters.ticks[static_cast<size_t>(which)], ticks);
+        own.add(counters.calls[static_cast<size_t>(which)], 1);
+    }
+
+    inline void count(const event which, const uint64_t value) {
+        own.add(own.get().events[static_cast<size_t>(which)], value);
+    }
+
+    struct scoped_timer {
+        explicit scoped_timer(const phase which) : which(which), start(now()) {}
+        ~scoped_timer() { record(which, now() - start); }
+
+        scoped_timer(const scoped_timer&) = delete;
+        scoped_timer& operator=(const scoped_timer&) = delete;
+
+    private:
+        phase which;
+        uint64_t start;
+    };
+
+    // Only while no instrumented code runs.
+    inline void reset() {
+        for (thread_counters& counters : blocks) {
+            for (auto& value : counters.ticks)
+                value.store(0, std::memory_order_relaxed);
+            for (auto& value : counters.calls)
+                value.store(0, std::memory_order_relaxed);
+            for (auto& value : counters.events)
+                value.store(0, std::memory_order_relaxed);
+        }
+        epoch = clock_epoch{};
+    }
+
+    inline snapshot collect() {
+        snapshot result;
+        const uint64_t ticks = now() - epoch.ticks;
+        const auto elapsed = std::chrono::steady_clock::now() - epoch.time;
+        result.seconds = std::chrono::duration<double>(elapsed).count();
+        const double nanoseconds_per_tick = ticks ? std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(ticks) : 1.0;
+
+        for (const thread_counters& counters : blocks) {
+            totals thread;
+            bool recorded = false;
+            for (size_t i = 0; i < phase_count; ++i) {
+                thread.nanoseconds[i] = static_cast<uint64_t>(static_cast<double>(counters.ticks[i].load(std::memory_order_relaxed)) * nanoseconds_per_tick);
+                thread.calls[i] = counters.calls[i].load(std::memory_order_relaxed);
+                recorded |= thread.calls[i] != 0;
+            }
+            for (size_t i = 0; i < event_count; ++i) {
+                thread.events[i] = counters.events[i].load(std::memory_order_relaxed);
+                recorded |= thread.events[i] != 0;
+            }
+            if (!recorded)
+                continue;
+
+            for (size_t i = 0; i < phase_count; ++i) {
+                result.all.nanoseconds[i] += thread.nanoseconds[i];
+                result.all.calls[i] += thread.calls[i];
+            }
+            for (size_t i = 0; i < event_count; ++i)
+                result.all.events[i] += thread.events[i];
+            result.threads.push_back(thread);
+        }
+        return result;
+    }
+#else
+    inline void reset() {}
+
+    inline snapshot collect() {
+        return {};
+    }
+#endif
+
+    inline void write_text(std::FILE* out, const snapshot& stats) {
+        const double timed = static_cast<double>(stats.all.timed_nanoseconds());
+        std::fprintf(out, "%-10s %12s %12s %10s %7s\n", "phase", "calls", "total ms", "ns/call", "share");
+        for (size_t i = 0; i < phase_count; ++i) {
+            const uint64_t calls = stats.all.calls[i];
+            if (!calls)
+                continue;
+            const double nanoseconds = static_cast<double>(stats.all.nanoseconds[i]);
+            std::fprintf(out, "%-10s %12llu %12.1f %10.1f %6.1f%%\n", phase_name(static_cast<phase>(i)), static_cast<unsigned long long>(calls),
+                nanoseconds * 1e-6, nanoseconds / static_cast<double>(calls), timed > 0.0 ? 100.0 * nanoseconds / timed : 0.0);
+        }
+        std::fprintf(out, "%zu threads over %.2fs:", stats.threads.size(), stats.seconds);
+        for (size_t i = 0; i < event_count; ++i)
+            std::fprintf(out, " %s %llu", event_name(static_cast<event>(i)), static_cast<unsigned long long>(stats.all.events[i]));
+        std::fprintf(out, "\n");
+    }
+
+    inline void write_json_totals(std::FILE* out, const totals& values) {
+        std::fprintf(out, "{\"phases\": {");
+        for (size_t i = 0; i < phase_count; ++i) {
+            std::fprintf(out, "%s\"%s\": {\"calls\": %llu, \"nanoseconds\": %llu}", i ? ", " : "", phase_name(static_cast<phase>(i)),
+                static_cast<unsigned long long>(values.calls[i]), static_cast<unsigned long long>(values.nanoseconds[i]));
+        }
+        std::fprintf(out, "}, \"events\": {");
+        for (size_t i = 0; i < event_count; ++i)
+            std::fprintf(out, "%s\"%s\": %llu", i ? ", " : "", event_name(static_cast<event>(i)), static_cast<unsigned long long>(values.events[i]));
+        std::fprintf(out, "}}");
+    }
+
+    inline void write_json(std::FILE* out, const snapshot& stats) {
+        std::fprintf(out, "{\n  \"enabled\": %s,\n  \"seconds\": %.6f,\n  \"total\": ", enabled ? "true" : "false", stats.seconds);
+        write_json_totals(out, stats.all);
+        std::fprintf(out, ",\n  \"threads\": [");
+        for (size_t i = 0; i < stats.threads.size(); ++i) {
+            std::fprintf(out, "%s\n    ", i ? "," : "");
+            write_json_totals(out, stats.threads[i]);
+        }
+        std::fprintf(out, "%s]\n}\n", stats.threads.empty() ? "" : "\n  ");
+    }
+}
+
+#if defined(GA_HC_INSTRUMENT)
+#define GA_HC_INSTRUMENT_JOIN_(a, b) a##b
+#define GA_HC_INSTRUMENT_JOIN(a, b) GA_HC_INSTRUMENT_JOIN_(a, b)
+#define GA_HC_TIME(name) const instrument::scoped_timer GA_HC_INSTRUMENT_JOIN(instrument_timer_, __LINE__)(instrument::phase::name)
+#define GA_HC_COUNT(name, value) instrument::count(instrument::event::name, (value))
+#else
+#define GA_HC_TIME(name) static_cast<void>(0)
+#define GA_HC_COUNT(name, value) static_cast<void>(0)
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded queue for many producers and one consumer, without locks. Every
+// cell carries a sequence number telling whose turn it is: a producer claims
+// the next cell with one compare-and-swap on the tail, fills it and bumps its
+// sequence, and the consumer takes cells in order once their sequence says
+// they are filled. A full queue makes try_push fail instead of waiting, so
+// producers never block.
+template <typename T>
+struct mpsc_queue {
+    // Not thread safe; capacity is rounded up to a power of two.
+    void reset(const size_t capacity) {
+        size_t size = 2;
+        while (size < capacity)
+            size *= 2;
+        cells = std::make_unique<cell[]>(size);
+        mask = size - 1;
+        for (size_t i = 0; i < size; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        head = 0;
+    }
+
+    size_t capacity() const {
+        return mask + 1;
+    }
+
+    bool try_push(const T& value) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            cell& slot = cells[position & mask];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t lag = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (lag == 0) {
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (lag < 0) {
+                return false;
+            }
+            else {
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer only.
+    bool try_pop(T& out) {
+        cell& slot = cells[head & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            return false;
+        out = slot.value;
+        slot.sequence.store(head + mask + 1, std::memory_order_release);
+        ++head;
+        return true;
+    }
+
+private:
+    struct cell {
+        std::atomic<size_t> sequence{ 0 };
+        T value{};
+    };
+
+    std::unique_ptr<cell[]> cells;
+    size_t mask = 0;
+    alignas(64) std::atomic<size_t> tail{ 0 };
+    alignas(64) size_t head = 0;
+};
@@ -0,0 +1,106 @@
+#pragma once
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <signal.h>
+#include <sys/resource.h>
+#endif
+#include <cstdlib>
+#include <cstring>
+#include <stop_token>
+#include <thread>
+
+namespace platform {
+    // Scheduling levels for the evolution threads, from yielding to everything
+    // else on the machine to ahead of ordinary desktop work.
+    enum class priority {
+        idle,
+        low,
+        normal,
+        high
+    };
+
+    inline const char* priority_name(const priority value) {
+        switch (value) {
+        case priority::idle: return "idle";
+        case priority::low: return "low";
+        case priority::high: return "high";
+        default: return "normal";
+        }
+    }
+
+    inline bool parse_priority(const char* text, priority& value) {
+        for (const priority candidate : { priority::idle, priority::low, priority::normal, priority::high }) {
+            if (std::strcmp(text, priority_name(candidate)) == 0) {
+                value = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Applies level to the calling thread; false if the OS refused. Elsewhere
+    // than Windows this is the nice value (19, 10, 0, -5), which Linux keeps
+    // per thread. Without privileges (CAP_SYS_NICE or RLIMIT_NICE) a thread can
+    // only lower its priority: going above normal, or back up after idle or
+    // low, fails and leaves the current level in place.
+    inline bool set_thread_priority(const priority level) {
+#ifdef _WIN32
+        static constexpr int levels[] = { THREAD_PRIORITY_IDLE, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL, THREAD_PRIORITY_ABOVE_NORMAL };
+        return SetThreadPriority(GetCurrentThread(), levels[static_cast<int>(level)]) != 0;
+#else
+        static constexpr int levels[] = { 19, 10, 0, -5 };
+        return setpriority(PRIO_PROCESS, 0, levels[static_cast<int>(level)]) == 0;
+#endif
+    }
+
+    // Applies level to the whole process where the OS has such a notion
+    // (Windows priority classes), otherwise to the calling thread; threads
+    // created afterwards inherit it on POSIX. False if the OS refused.
+    inline bool set_process_priority(const priority level) {
+#ifdef _WIN32
+        static constexpr DWORD classes[] = { IDLE_PRIORITY_CLASS, BELOW_NORMAL_PRIORITY_CLASS, NORMAL_PRIORITY_CLASS, ABOVE_NORMAL_PRIORITY_CLASS };
+        return SetPriorityClass(GetCurrentProcess(), classes[static_cast<int>(level)]) != 0;
+#else
+        return set_thread_priority(level);
+#endif
+    }
+
+#ifdef _WIN32
+    inline std::stop_source interrupt_source{ std::nostopstate };
+
+    inline BOOL WINAPI interrupt_handler(DWORD) {
+        // A second request falls through to the default handler, which ends the process.
+        if (!interrupt_source.stop_possible() || interrupt_source.stop_requested())
+            return FALSE;
+        interrupt_source.request_stop();
+        return TRUE;
+    }
+#endif
+
+    // Turns Ctrl+C and termination requests into source.request_stop(); a
+    // second one ends the process at once. Call before starting any other
+    // thread: on POSIX the signals are blocked in the caller, every thread
+    // started later inherits that, and a helper thread waits for them.
+    inline void stop_on_interrupt(std::stop_source source) {
+#ifdef _WIN32
+        interrupt_source = std::move(source);
+        SetConsoleCtrlHandler(interrupt_handler, TRUE);
+#else
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGINT);
+        sigaddset(&signals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+        std::thread([signals, source = std::move(source)]() mutable {
+            int signal = 0;
+            sigwait(&signals, &signal);
+            source.request_stop();
+            sigwait(&signals, &signal);
+            std::_Exit(128 + signal);
+        }).detach();
+#endif
+    }
+}
@@ -1,14 +1,243 @@
 #pragma once
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <random>
 
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace rng {
+    inline uint64_t splitmix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Seed for an independent stream (e.g. one worker) derived from a base seed.
+    inline uint64_t derive_seed(const uint64_t base, const uint64_t stream) {
+        uint64_t state = base ^ (stream * 0xD1B54A32D192ED03ULL);
+        splitmix64(state);
+        return splitmix64(state);
+    }
+
+    inline void multiply_128(const uint64_t a, const uint64_t b, uint64_t& high, uint64_t& low) {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        high = static_cast<uint64_t>(product >> 64);
+        low = static_cast<uint64_t>(product);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        low = _umul128(a, b, &high);
+#else
+        const uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+        const uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+        const uint64_t lo_lo = a_lo * b_lo;
+        const uint64_t hi_lo = a_hi * b_lo;
+        const uint64_t lo_hi = a_lo * b_hi;
+        const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+        high = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+        low = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+#endif
+    }
+
+    struct xoshiro256pp {
+        using result_type = uint64_t;
+        uint64_t s[4];
+
+        explicit xoshiro256pp(uint64_t seed = 0) { this->seed(seed); }
+
+        void seed(uint64_t seed) {
+            for (auto& word : s)
+                word = splitmix64(seed);
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            const uint64_t result = std::rotl(s[0] + s[3], 23) + s[0];
+            const uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = std::rotl(s[3], 45);
+            return result;
+        }
+    };
+
+    // PCG XSL RR 128/64 (pcg64 in the reference implementation).
+    struct pcg64 {
+        using result_type = uint64_t;
+        uint64_t state_high = 0, state_low = 0;
+        uint64_t increment_high = 0, increment_low = 0;
+
+        explicit pcg64(uint64_t seed = 0) { this->seed(seed); }
+
+        void seed(uint64_t seed) {
+            const uint64_t initial_high = splitmix64(seed), initial_low = splitmix64(seed);
+            increment_high = splitmix64(seed);
+            increment_low = splitmix64(seed) | 1;
+            state_high = state_low = 0;
+            step();
+            add(state_high, state_low, initial_high, initial_low);
+            step();
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            step();
+            return std::rotr(state_high ^ state_low, static_cast<int>(state_high >> 58));
+        }
+
+    private:
+        static void add(uint64_t& high, uint64_t& low, const uint64_t add_high, const uint64_t add_low) {
+            low += add_low;
+            high += add_high + (low < add_low ? 1 : 0);
+        }
+
+        void step() {
+            constexpr uint64_t multiplier_high = 0x2360ED051FC65DA4ULL;
+            constexpr uint64_t multiplier_low = 0x4385DF649FCCF645ULL;
+
+            uint64_t high, low;
+            multiply_128(state_low, multiplier_low, high, low);
+            high += state_high * multiplier_low + state_low * multiplier_high;
+            state_high = high;
+            state_low = low;
+            add(state_high, state_low, increment_high, increment_low);
+        }
+    };
+
+    struct wyrand {
+        using result_type = uint64_t;
+        uint64_t state = 0;
+
+        explicit wyrand(uint64_t seed = 0) { this->seed(seed); }
+
+        void seed(uint64_t seed) { state = splitmix64(seed); }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            state += 0xA0761D6478BD642FULL;
+            uint64_t high, low;
+            multiply_128(state, state ^ 0xE7037ED1A0B428DBULL, high, low);
+            return high ^ low;
+        }
+    };
+
+#if defined(GA_HC_RNG_PCG64)
+    using engine = pcg64;
+#elif defined(GA_HC_RNG_WYRAND)
+    using engine = wyrand;
+#else
+    using engine = xoshiro256pp;
+#endif
+
+    // Uniform float in [0, 1) from the top 24 bits.
+    inline float to_unit_float(const uint64_t bits) {
+        return static_cast<float>(bits >> 40) * (1.f / 16777216.f);
+    }
+
+    // Uniform double in [0, 1) from the top 53 bits.
+    inline double to_unit_double(const uint64_t bits) {
+        return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform integer in [0, bound) (Lemire's multiply-shift with rejection).
+    template <typename Engine>
+    inline uint32_t bounded(Engine& engine, const uint32_t bound) {
+        uint64_t product = (engine() >> 32) * bound;
+        uint32_t low = static_cast<uint32_t>(product);
+        if (low < bound) {
+            const uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                product = (engine() >> 32) * bound;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<uint32_t>(product >> 32);
+    }
+
+    template <typename Engine>
+    inline void fill_bytes(Engine& engine, uint8_t* out, const size_t count) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const uint64_t bits = engine();
+            std::memcpy(out + i, &bits, 8);
+        }
+        if (i < count) {
+            const uint64_t bits = engine();
+            std::memcpy(out + i, &bits, count - i);
+        }
+    }
+
+    inline uint64_t random_seed() {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }
+
+    // Per-thread engine used by random_float/random_int. Unseeded threads start
+    // from std::random_device; workers call seed_thread for reproducible runs.
+    inline engine& thread_engine() {
+        static thread_local engine generator(random_seed());
+        return generator;
+    }
+
+    inline void seed_thread(const uint64_t seed) {
+        thread_engine().seed(seed);
+    }
+}
+
 inline float random_float(const float begin, const float end) {
-    static thread_local std::mt19937 generator(std::random_device{}());
-    std::uniform_real_distribution<float> distribution(begin, end);
-    return distribution(generator);
+    return begin + (end - begin) * rng::to_unit_float(rng::thread_engine()());
 }
 
 inline int random_int(const int begin, const int end) {
-    static thread_local std::mt19937 generator(std::random_device{}());
-    std::uniform_int_distribution<int> distribution(begin, end);
-    return distribution(generator);
-}
\ No newline at end of file
+    const uint32_t range = static_cast<uint32_t>(end - begin) + 1U;
+    if (range == 0U)
+        return static_cast<int>(static_cast<uint32_t>(rng::thread_engine()() >> 32));
+    return begin + static_cast<int>(rng::bounded(rng::thread_engine(), range));
+}
+
+inline void random_bytes(uint8_t* out, const size_t count) {
+    rng::fill_bytes(rng::thread_engine(), out, count);
+}
+
+// Number of failed Bernoulli trials before the next success, capped at limit.
+// log_q is log(1 - p) for success probability p.
+inline size_t random_skip(const double log_q, const size_t limit) {
+    const double u = 1.0 - rng::to_unit_double(rng::thread_engine()());
+    const double skip = std::floor(std::log(u) / log_q);
+    return skip < static_cast<double>(limit) ? static_cast<size_t>(skip) : limit;
+}
+
+// Calls func(i) for every i in [0, count) that succeeds an independent trial
+// with the given probability. Gaps between successes are drawn from the
+// geometric distribution, so the cost is proportional to the number of hits.
+template <typename Func>
+inline void for_each_sampled(const size_t count, const float probability, Func func) {
+    if (probability <= 0.f)
+        return;
+
+    if (probability >= 1.f) {
+        for (size_t i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    const double log_q = std::log1p(-static_cast<double>(probability));
+    for (size_t i = random_skip(log_q, count); i < count; i += 1 + random_skip(log_q, count)) {
+        func(i);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "individual.h"
+
+// Lowest-error individual offered by any of several threads, readable by any
+// of them, without locks. The individual lives in one of a few buffers; a
+// single atomic word holds its error and buffer index, so offering a better
+// one is a buffer copy and one compare-and-swap. Every buffer counts the
+// threads reading it, and a writer only claims a buffer nobody reads and
+// that does not hold the current best, so readers never see a torn copy.
+struct shared_best {
+    // Not thread safe. Buffers must outnumber the threads that offer or
+    // read at the same time; sizing them here keeps later copies from
+    // allocating.
+    void reset(const size_t genome_size, const size_t buffer_count) {
+        buffers.assign(buffer_count, individual{ std::vector<uint8_t>(genome_size) });
+        users = std::make_unique<std::atomic<uint32_t>[]>(buffer_count);
+        for (size_t i = 0; i < buffer_count; ++i)
+            users[i].store(0, std::memory_order_relaxed);
+        current.store(empty, std::memory_order_relaxed);
+    }
+
+    // Error of the best offered so far, UINT64_MAX >> index_bits if none.
+    uint64_t error() const {
+        return current.load(std::memory_order_acquire) >> index_bits;
+    }
+
+    // Returns whether candidate became the best. Fails, rarely, when every
+    // buffer is busy; offering again later is fine.
+    bool offer(const individual& candidate) {
+        if (candidate.error >= error())
+            return false;
+
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            uint32_t idle = 0;
+            if (!users[i].compare_exchange_strong(idle, writing, std::memory_order_acquire, std::memory_order_relaxed))
+                continue;
+            if ((current.load(std::memory_order_acquire) & index_mask) == i) {
+                users[i].fetch_sub(writing, std::memory_order_release);
+                continue;
+            }
+
+            buffers[i] = candidate;
+            bool published = false;
+            uint64_t seen = current.load(std::memory_order_relaxed);
+            while (!published && candidate.error < (seen >> index_bits))
+                published = current.compare_exchange_weak(seen, (candidate.error << index_bits) | i, std::memory_order_acq_rel, std::memory_order_relaxed);
+            users[i].fetch_sub(writing, std::memory_order_release);
+            return published;
+        }
+        return false;
+    }
+
+    // Copies the best into out; false if nothing was offered yet.
+    bool read(individual& out) {
+        for (;;) {
+            const uint64_t seen = current.load(std::memory_order_acquire);
+            if (seen == empty)
+                return false;
+
+            const size_t i = seen & index_mask;
+            const bool pinned = !(users[i].fetch_add(1, std::memory_order_acquire) & writing) && (current.load(std::memory_order_acquire) & index_mask) == i;
+            if (pinned)
+                out = buffers[i];
+            users[i].fetch_sub(1, std::memory_order_release);
+            if (pinned)
+                return true;
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    static constexpr unsigned int index_bits = 16;
+    static constexpr uint64_t index_mask = (1ULL << index_bits) - 1;
+    static constexpr uint64_t empty = ~0ULL;
+    static constexpr uint32_t writing = 1U << 31;
+
+    std::vector<individual> buffers;
+    std::unique_ptr<std::atomic<uint32_t>[]> users;
+    // error << index_bits | index of the buffer holding it.
+    alignas(64) std::atomic<uint64_t> current{ empty };
+};
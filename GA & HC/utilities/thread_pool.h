@@ -0,0 +1,157 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work-stealing pool: every worker owns a deque, pops its own work from the
+// back and steals from the front of the others when it runs dry. Threads that
+// submit work help run queued tasks while they wait, so a pool with zero
+// workers still makes progress.
+struct thread_pool {
+    struct task {
+        void (*run)(void*);
+        void* context;
+    };
+
+    explicit thread_pool(const unsigned int thread_count) {
+        for (unsigned int i = 0; i < thread_count; ++i)
+            queues.push_back(std::make_unique<task_queue>());
+        for (unsigned int i = 0; i < thread_count; ++i)
+            threads.emplace_back([this, i] { worker(i); });
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    unsigned int size() const {
+        return static_cast<unsigned int>(threads.size());
+    }
+
+    void submit(const task work) {
+        if (queues.empty()) {
+            work.run(work.context);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(wake_mtx);
+            pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        auto& queue = *queues[next_queue.fetch_add(1, std::memory_order_relaxed) % queues.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mtx);
+            queue.tasks.push_back(work);
+        }
+        wake.notify_one();
+    }
+
+    // Runs one queued task on the calling thread, starting the search at queue `first`.
+    bool try_run_one(const size_t first) {
+        for (size_t k = 0; k < queues.size(); ++k) {
+            auto& queue = *queues[(first + k) % queues.size()];
+            task work;
+            {
+                std::lock_guard<std::mutex> lock(queue.mtx);
+                if (queue.tasks.empty())
+                    continue;
+                if (k == 0) {
+                    work = queue.tasks.back();
+                    queue.tasks.pop_back();
+                }
+                else {
+                    work = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+            }
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            work.run(work.context);
+            return true;
+        }
+        return false;
+    }
+
+    // Calls func(i) for every i in [0, count) on up to `parallelism` threads,
+    // the calling thread included, and returns once all calls have finished.
+    // Indices are handed out dynamically, so func must not depend on which
+    // thread runs it.
+    template <typename Func>
+    void parallel_for(const size_t count, unsigned int parallelism, Func&& func) {
+        parallelism = static_cast<unsigned int>(std::min<size_t>({ parallelism, size() + 1U, count }));
+        if (parallelism <= 1U) {
+            for (size_t i = 0; i < count; ++i)
+                func(i);
+            return;
+        }
+
+        struct job {
+            Func& func;
+            size_t count;
+            std::atomic<size_t> next{ 0 };
+            std::atomic<unsigned int> helpers;
+
+            void drain() {
+                for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed))
+                    func(i);
+            }
+        };
+
+        job work{ func, count, {}, { parallelism - 1U } };
+        for (unsigned int i = 1; i < parallelism; ++i) {
+            submit({ [](void* context) {
+                auto& work = *static_cast<job*>(context);
+                work.drain();
+                work.helpers.fetch_sub(1, std::memory_order_release);
+            }, &work });
+        }
+
+        work.drain();
+
+        const size_t first = next_queue.load(std::memory_order_relaxed);
+        while (work.helpers.load(std::memory_order_acquire) != 0U) {
+            if (!try_run_one(first))
+                std::this_thread::yield();
+        }
+    }
+
+private:
+    struct task_queue {
+        std::mutex mtx;
+        std::deque<task> tasks;
+    };
+
+    void worker(const size_t index) {
+        while (true) {
+            if (try_run_one(index))
+                continue;
+
+            std::unique_lock<std::mutex> lock(wake_mtx);
+            wake.wait(lock, [this] { return stopping || pending.load(std::memory_order_relaxed) != 0; });
+            if (stopping && pending.load(std::memory_order_relaxed) == 0)
+                return;
+        }
+    }
+
+    std::vector<std::unique_ptr<task_queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> next_queue{ 0 };
+    std::atomic<size_t> pending{ 0 };
+    std::mutex wake_mtx;
+    std::condition_variable wake;
+    bool stopping = false;
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stop_token>
+#include "cancellation.h"
+#include "platform.h"
+
+// CPU budget for the evolution workers. Every worker owns a limiter, a token
+// bucket refilled at `utilization` seconds of work per wall clock second and
+// drained by the work it does; once the worker is `burst` in debt it sleeps
+// until the bucket is empty again or it is asked to stop. The settings are
+// plain atomics read at every check, so they can be changed while workers run.
+namespace throttle {
+    // Fraction of one core each worker thread may use; 1 = unthrottled.
+    inline std::atomic<float> utilization{ 1.f };
+    inline std::atomic<platform::priority> priority{ platform::priority::normal };
+    // Set once the OS refused a worker's priority change, see
+    // platform::set_thread_priority; the worker keeps its previous level.
+    inline std::atomic<bool> priority_refused{ false };
+
+    // Time all workers together spent sleeping for the budget.
+    inline std::atomic<uint64_t> throttled_nanoseconds{ 0 };
+
+    inline constexpr float min_utilization = 0.05f;
+    inline constexpr std::chrono::milliseconds burst(10);
+
+    inline void set_utilization(const float value) {
+        utilization.store(std::clamp(value, min_utilization, 1.f));
+    }
+
+    inline double throttled_seconds() {
+        return static_cast<double>(throttled_nanoseconds.load()) * 1e-9;
+    }
+
+    struct limiter {
+        // check_interval is the number of step() calls between clock reads,
+        // so cheap steps do not pay for one each; threads is how many threads
+        // the owner keeps busy, the owner included. Sleeps end early once
+        // stop is requested.
+        explicit limiter(const unsigned int check_interval, const unsigned int threads = 1U, std::stop_token stop = {})
+            : check_interval(std::max(check_interval, 1U)), threads(std::max(threads, 1U)), stop(std::move(stop)) {
+            apply_priority(applied);
+        }
+
+        void step() {
+            if (++steps < check_interval)
+                return;
+            steps = 0;
+            check();
+        }
+
+        void check() {
+            using nanoseconds = std::chrono::duration<double, std::nano>;
+
+            const auto now = std::chrono::steady_clock::now();
+            const double worked = nanoseconds(now - last).count() * threads;
+            last = now;
+
+            const platform::priority level = priority.load(std::memory_order_relaxed);
+            if (level != applied) {
+                apply_priority(level);
+                applied = level;
+            }
+
+            const float rate = utilization.load(std::memory_order_relaxed);
+            if (rate >= 1.f) {
+                tokens = 0.0;
+                return;
+            }
+
+            tokens -= worked * (1.0 - rate);
+            const double limit = nanoseconds(burst).count();
+            if (tokens > -limit)
+                return;
+
+            sleeper.sleep_for(stop, std::chrono::duration_cast<std::chrono::steady_clock::duration>(nanoseconds(-tokens / rate)));
+            last = std::chrono::steady_clock::now();
+            const double slept = nanoseconds(last - now).count();
+            tokens = std::min(tokens + slept * rate, limit);
+
+            throttled_nanoseconds.fetch_add(static_cast<uint64_t>(slept), std::memory_order_relaxed);
+        }
+
+    private:
+        static void apply_priority(const platform::priority level) {
+            if (!platform::set_thread_priority(level))
+                priority_refused.store(true, std::memory_order_relaxed);
+        }
+
+        unsigned int check_interval;
+        unsigned int threads;
+        unsigned int steps = 0;
+        std::stop_token stop;
+        cancellation::sleeper sleeper;
+        double tokens = 0.0;
+        std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+        platform::priority applied = priority.load();
+    };
+}
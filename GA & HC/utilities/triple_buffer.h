@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Lock-free channel for the latest value from one writer thread to one
+// reader thread. The writer fills its own back buffer and publishes it with
+// a single atomic exchange, so publishing is wait-free; the reader swaps in
+// the newest published buffer, which nobody else touches until it swaps
+// again, so what it reads is never torn. Intermediate values the reader
+// does not pick up in time are simply overwritten.
+template <typename T>
+struct triple_buffer {
+    // Not thread safe: sets every buffer to value and forgets anything
+    // published. Assigning the value also sizes the buffers, so later
+    // publishes of a same-sized T need not allocate.
+    void reset(const T& value) {
+        for (T& buffer : buffers)
+            buffer = value;
+        middle.store(1, std::memory_order_relaxed);
+        back_index = 0;
+        front_index = 2;
+    }
+
+    // Writer: the buffer to fill, then publish() it.
+    T& back() {
+        return buffers[back_index];
+    }
+
+    void publish() {
+        back_index = middle.exchange(back_index | fresh, std::memory_order_acq_rel) & index_mask;
+    }
+
+    // Reader: takes the newest published value, if any arrived since the
+    // last call; returns whether front() changed.
+    bool acquire() {
+        if (!(middle.load(std::memory_order_relaxed) & fresh))
+            return false;
+        front_index = middle.exchange(front_index, std::memory_order_acq_rel) & index_mask;
+        return true;
+    }
+
+    const T& front() const {
+        return buffers[front_index];
+    }
+
+private:
+    static constexpr uint8_t index_mask = 3;
+    static constexpr uint8_t fresh = 4;
+
+    T buffers[3];
+    // Index of the buffer between writer and reader, plus `fresh` while it
+    // holds a value the reader has not taken.
+    alignas(64) std::atomic<uint8_t> middle{ 1 };
+    alignas(64) uint8_t back_index = 0;
+    alignas(64) uint8_t front_index = 2;
+};